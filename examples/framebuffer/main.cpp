@@ -6,48 +6,50 @@
  * It first draws a cube and floor to generated framebuffer and apply Gaussian blur filter to offscreen rendered texture
  * and present it into the screen framebuffer.
  * The original source is from LearnOpenGL, https://learnopengl.com/Advanced-OpenGL/Framebuffers .
+ * CPU and GPU time of each pass is measured by GpuProfiler and shown in the ImGui overlay.
+ * The cube and floor textures are packed into a single TextureAtlas, so both objects are drawn without changing the
+ * texture binding; only the atlas region uniform differs per draw.
+ * The blur kernel size is injected as KERNEL_SIZE by ProgramVariants, and can be changed in the overlay. All sizes are
+ * built at startup, so switching does not compile during frames.
  */
 
 #include <OpenGLApp/Window.hpp>
 #include <OpenGLApp/Program.hpp>
+#include <OpenGLApp/ProgramVariants.hpp>
 #include <OpenGLApp/Camera.hpp>
+#include <OpenGLApp/GLObject.hpp>
+#include <OpenGLApp/GpuProfiler.hpp>
+#include <OpenGLApp/TextureAtlas.hpp>
 #include <OpenGLApp/Utils/Image.hpp>
+#include <OpenGLApp/Utils/ProfilerOverlay.hpp>
 #include <glm/gtc/matrix_transform.hpp>
+#include <imgui.h>
+#include <imgui_impl_glfw.h>
+#include <imgui_impl_opengl3.h>
 
 #include "../models.hpp"
 
-struct GLObject{
-    const GLuint vao;
-    const GLuint vbo;
-
-    GLObject() : vao { generateVertexArray() }, vbo { generateBuffer() }{
-
-    }
-
-    ~GLObject() noexcept{
-        glDeleteVertexArrays(1, &vao);
-        glDeleteBuffers(1, &vbo);
-    }
-
-    static GLuint generateVertexArray(){
-        GLuint handle;
-        glGenVertexArrays(1, &handle);
-        return handle;
-    }
-
-    static GLuint generateBuffer(){
-        GLuint handle;
-        glGenBuffers(1, &handle);
-        return handle;
-    }
+struct Mesh{
+    OpenGL::VertexArray vao;
+    OpenGL::Buffer vbo;
 };
 
 class App : public OpenGL::Window {
 private:
-    OpenGL::Program render_program, blur_program;
-    GLObject cube, plane, quad;
-    GLuint container_texture, metal_texture;
-    GLuint fbo, texture_color_buffer, rbo;
+    static constexpr std::array blur_kernel_sizes { 5, 9, 13 };
+
+    OpenGL::Program render_program;
+    OpenGL::ProgramVariants program_variants;
+    int blur_kernel_size_index = 2;
+    OpenGL::Program *blur_program;
+    Mesh cube, plane, quad;
+    OpenGL::TextureAtlas atlas { 2048, 2048 };
+    glm::vec4 container_region, metal_region; // (offset, scale) of each image in the atlas.
+    OpenGL::Framebuffer fbo;
+    OpenGL::Texture texture_color_buffer;
+    OpenGL::Renderbuffer rbo;
+
+    mutable OpenGL::GpuProfiler profiler; // Measured in draw(), which is const.
 
     OpenGL::PerspectiveCamera camera;
     std::optional<glm::vec2> previous_mouse_position;
@@ -62,8 +64,7 @@ private:
         projection = camera.projection.getMatrix(getFramebufferAspectRatio());
 
         // If screen size is changed, framebuffer's color buffer and render buffer also should be regenerated.
-        // Previous buffer should be destroyed, so pass the delete_previous parameter as true.
-        generateRenderbuffer(true);
+        generateRenderbuffer();
     }
 
     void onScrollChanged(double xoffset, double yoffset) override {
@@ -76,7 +77,7 @@ private:
     }
 
     void onMouseButtonChanged(int button, int action, int mods) override {
-        if (button == GLFW_MOUSE_BUTTON_LEFT && action == GLFW_PRESS){
+        if (button == GLFW_MOUSE_BUTTON_LEFT && action == GLFW_PRESS && !ImGui::GetIO().WantCaptureMouse){
             double mouse_x, mouse_y;
             glfwGetCursorPos(window, &mouse_x, &mouse_y);
 
@@ -103,43 +104,78 @@ private:
     void update(float time_delta) override {
         render_program.setUniform("model", model);
         render_program.setUniform("projection_view", projection * view);
-        blur_program.setUniform("framebuffer_size", getFramebufferSize());
-    }
-
-    void draw() const override {
-        // offscreen rendering (render to fbo).
-        glBindFramebuffer(GL_FRAMEBUFFER, fbo);
-        glEnable(GL_DEPTH_TEST);
-
-        glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
-
-        render_program.use();
 
-        render_program.setUniform("material_texture", 0);
-        glBindVertexArray(cube.vao);
-        glActiveTexture(GL_TEXTURE0);
-        glDrawArrays(GL_TRIANGLES, 0, 36);
+        ImGui_ImplOpenGL3_NewFrame();
+        ImGui_ImplGlfw_NewFrame();
+        ImGui::NewFrame();
+        OpenGL::Utils::drawProfilerOverlay(profiler);
+        ImGui::Begin("Blur");
+        ImGui::SliderInt("Kernel size", &blur_kernel_size_index, 0, static_cast<int>(blur_kernel_sizes.size()) - 1,
+                         std::to_string(blur_kernel_sizes[blur_kernel_size_index]).c_str());
+        ImGui::End();
+        ImGui::Render();
+
+        blur_program = &getBlurProgram(blur_kernel_sizes[blur_kernel_size_index]);
+        blur_program->setUniform("framebuffer_size", getFramebufferSize());
+    }
 
-        render_program.setUniform("material_texture", 1);
-        glBindVertexArray(plane.vao);
-        glActiveTexture(GL_TEXTURE1);
-        glDrawArrays(GL_TRIANGLES, 0, 6);
+    void draw(float interpolation_alpha) const override {
+        profiler.beginFrame();
+        {
+            const auto frame_scope = profiler.scope("Frame");
+            {
+                const auto scope = profiler.scope("Offscreen pass");
+
+                // offscreen rendering (render to fbo).
+                glBindFramebuffer(GL_FRAMEBUFFER, fbo.getHandle());
+                glEnable(GL_DEPTH_TEST);
+
+                glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+
+                render_program.use();
+
+                render_program.setUniform("material_region", container_region);
+                glBindVertexArray(cube.vao.getHandle());
+                glDrawArrays(GL_TRIANGLES, 0, 36);
+
+                render_program.setUniform("material_region", metal_region);
+                glBindVertexArray(plane.vao.getHandle());
+                glDrawArrays(GL_TRIANGLES, 0, 6);
+            }
+            {
+                const auto scope = profiler.scope("Blur pass");
+
+                // restore to default framebuffer and present the result into screen.
+                glBindFramebuffer(GL_FRAMEBUFFER, 0);
+                glDisable(GL_DEPTH_TEST);
+                glClear(GL_COLOR_BUFFER_BIT);
+
+                blur_program->use();
+                glBindVertexArray(quad.vao.getHandle());
+                glActiveTexture(GL_TEXTURE2);
+                glDrawArrays(GL_TRIANGLES, 0, 6);
+            }
+            {
+                const auto scope = profiler.scope("ImGui");
+                ImGui_ImplOpenGL3_RenderDrawData(ImGui::GetDrawData());
+            }
+        }
+        profiler.endFrame();
+    }
 
-        // restore to default framebuffer and present the result into screen.
-        glBindFramebuffer(GL_FRAMEBUFFER, 0);
-        glDisable(GL_DEPTH_TEST);
-        glClear(GL_COLOR_BUFFER_BIT);
+    void initImGui(){
+        IMGUI_CHECKVERSION();
+        ImGui::CreateContext();
+        ImGui::StyleColorsDark();
 
-        blur_program.use();
-        glBindVertexArray(quad.vao);
-        glActiveTexture(GL_TEXTURE2);
-        glDrawArrays(GL_TRIANGLES, 0, 6);
+        ImGui_ImplGlfw_InitForOpenGL(window, true);
+        ImGui_ImplOpenGL3_Init("#version 330");
     }
 
     void setObjects(){
         // Set cube vertices.
-        glBindVertexArray(cube.vao);
-        glBindBuffer(GL_ARRAY_BUFFER, cube.vbo);
+        glBindVertexArray(cube.vao.getHandle());
+        glBindBuffer(GL_ARRAY_BUFFER, cube.vbo.getHandle());
         glBufferData(GL_ARRAY_BUFFER,
                      static_cast<GLsizei>(sizeof(VertexPT<3>) * models::tex_cube.size()),
                      models::tex_cube.data(),
@@ -160,8 +196,8 @@ private:
         glEnableVertexAttribArray(1);
 
         // Set plane vertices.
-        glBindVertexArray(plane.vao);
-        glBindBuffer(GL_ARRAY_BUFFER, plane.vbo);
+        glBindVertexArray(plane.vao.getHandle());
+        glBindBuffer(GL_ARRAY_BUFFER, plane.vbo.getHandle());
         glBufferData(GL_ARRAY_BUFFER,
                      static_cast<GLsizei>(sizeof(VertexPT<3>) * models::plane.size()),
                      models::plane.data(),
@@ -182,8 +218,8 @@ private:
         glEnableVertexAttribArray(1);
 
         // Set quad vertices, which covers the full region of the screen.
-        glBindVertexArray(quad.vao);
-        glBindBuffer(GL_ARRAY_BUFFER, quad.vbo);
+        glBindVertexArray(quad.vao.getHandle());
+        glBindBuffer(GL_ARRAY_BUFFER, quad.vbo.getHandle());
         glBufferData(GL_ARRAY_BUFFER,
                      static_cast<GLsizei>(sizeof(VertexPT<2>) * models::full_quad.size()),
                      models::full_quad.data(),
@@ -205,58 +241,50 @@ private:
     }
 
     void setTextures(){
-        const OpenGL::Utils::Image container_img { "assets/container.jpg" };
-        glGenTextures(1, &container_texture);
+        // Load as RGBA regardless of the file's channels, so that the atlas copies them without conversion. Images are
+        // decoded in parallel, and their buffers are only needed until the atlas is built, so they are in an arena.
+        constexpr OpenGL::Utils::Image::LoadOptions load_options { .layout = OpenGL::Utils::Image::PixelLayout::Rgba };
+        constexpr std::array filenames { "assets/container.jpg", "assets/metal.png" };
+        OpenGL::Utils::ArenaImageAllocator image_allocator;
+        const std::vector images = OpenGL::Utils::Image::load(filenames, load_options, image_allocator);
+
+        const auto toVec4 = [](const OpenGL::TextureAtlas::Region &region){
+            return glm::vec4 { region.offset, region.scale };
+        };
+        container_region = toVec4(atlas.getRegion(atlas.add(images[0]).value()));
+        metal_region = toVec4(atlas.getRegion(atlas.add(images[1]).value()));
+
         glActiveTexture(GL_TEXTURE0);
-        glBindTexture(GL_TEXTURE_2D, container_texture);
-        glTexImage2D(GL_TEXTURE_2D,
-                     0,
-                     GL_RGB,
-                     container_img.width,
-                     container_img.height,
-                     0,
-                     GL_RGB,
-                     GL_UNSIGNED_BYTE,
-                     container_img.data);
-        glGenerateMipmap(GL_TEXTURE_2D);
-
-        const OpenGL::Utils::Image metal_img { "assets/metal.png" };
-        glGenTextures(1, &metal_texture);
-        glActiveTexture(GL_TEXTURE1);
-        glBindTexture(GL_TEXTURE_2D, metal_texture);
-        glTexImage2D(GL_TEXTURE_2D,
-                     0,
-                     GL_RGB,
-                     metal_img.width,
-                     metal_img.height,
-                     0,
-                     GL_RGB,
-                     GL_UNSIGNED_BYTE,
-                     metal_img.data);
-        glGenerateMipmap(GL_TEXTURE_2D);
+        atlas.build();
+        render_program.setUniform("material_texture", 0);
+    }
+
+    OpenGL::Program &getBlurProgram(int kernel_size){
+        return program_variants.get("shaders/framebuffer/gaussian_blur.vert", "shaders/framebuffer/gaussian_blur.frag",
+                                    { { "KERNEL_SIZE", std::to_string(kernel_size) } });
     }
 
     void setFramebuffer(){
-        glGenFramebuffers(1, &fbo);
-        generateRenderbuffer(false);
+        generateRenderbuffer();
 
-        blur_program.setUniform("screen_texture", 2);
+        for (int kernel_size : blur_kernel_sizes){
+            getBlurProgram(kernel_size).setUniform("screen_texture", 2);
+        }
+        blur_program = &getBlurProgram(blur_kernel_sizes[blur_kernel_size_index]);
     }
 
-    void generateRenderbuffer(bool delete_previous){
-        if (delete_previous){
-            glDeleteTextures(1, &texture_color_buffer);
-            glDeleteRenderbuffers(1, &rbo);
-        }
+    void generateRenderbuffer(){
+        // Previous buffers are deleted after the GPU finished the frames using them.
+        texture_color_buffer = OpenGL::Texture{};
+        rbo = OpenGL::Renderbuffer{};
 
         // You should use framebuffer size, not window size.
         const auto framebuffer_size = getFramebufferSize();
 
-        glBindFramebuffer(GL_FRAMEBUFFER, fbo);
+        glBindFramebuffer(GL_FRAMEBUFFER, fbo.getHandle());
 
-        glGenTextures(1, &texture_color_buffer);
         glActiveTexture(GL_TEXTURE2);
-        glBindTexture(GL_TEXTURE_2D, texture_color_buffer);
+        glBindTexture(GL_TEXTURE_2D, texture_color_buffer.getHandle());
         glTexImage2D(GL_TEXTURE_2D,
                      0,
                      GL_RGB,
@@ -267,20 +295,18 @@ private:
                      GL_UNSIGNED_BYTE, nullptr);
         glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
         glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
-        glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, texture_color_buffer, 0);
+        glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, texture_color_buffer.getHandle(), 0);
 
-        glGenRenderbuffers(1, &rbo);
-        glBindRenderbuffer(GL_RENDERBUFFER, rbo);
+        glBindRenderbuffer(GL_RENDERBUFFER, rbo.getHandle());
         glRenderbufferStorage(GL_RENDERBUFFER, GL_DEPTH24_STENCIL8, framebuffer_size.x, framebuffer_size.y);
-        glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_DEPTH_STENCIL_ATTACHMENT, GL_RENDERBUFFER, rbo);
+        glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_DEPTH_STENCIL_ATTACHMENT, GL_RENDERBUFFER, rbo.getHandle());
 
         assert(glCheckFramebufferStatus(GL_FRAMEBUFFER) == GL_FRAMEBUFFER_COMPLETE);
     }
 
 public:
     App() : OpenGL::Window { 800, 480, "Framebuffer" },
-            render_program { "shaders/framebuffer/render.vert", "shaders/framebuffer/render.frag" },
-            blur_program { "shaders/framebuffer/gaussian_blur.vert", "shaders/framebuffer/gaussian_blur.frag" }
+            render_program { "shaders/framebuffer/render.vert", "shaders/framebuffer/render.frag" }
     {
         camera.view.distance = 5.f;
         camera.view.addPitch(-0.5f);
@@ -291,16 +317,15 @@ public:
         setObjects();
         setTextures();
         setFramebuffer();
+        initImGui();
 
         glClearColor(0.f, 0.f, 0.f, 1.0f);
     }
 
     ~App() noexcept override{
-        glDeleteRenderbuffers(1, &rbo);
-        glDeleteFramebuffers(1, &fbo);
-        glDeleteTextures(1, &container_texture);
-        glDeleteTextures(1, &metal_texture);
-        glDeleteTextures(1, &texture_color_buffer);
+        ImGui_ImplOpenGL3_Shutdown();
+        ImGui_ImplGlfw_Shutdown();
+        ImGui::DestroyContext();
     }
 };
 
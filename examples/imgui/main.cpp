@@ -38,7 +38,7 @@ private:
         ImGui::Render();
     }
 
-    void draw() const override {
+    void draw(float interpolation_alpha) const override {
         glClear(GL_COLOR_BUFFER_BIT);
         ImGui_ImplOpenGL3_RenderDrawData(ImGui::GetDrawData());
     }
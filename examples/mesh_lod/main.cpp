@@ -0,0 +1,209 @@
+//
+// Created by gomkyung2 on 2026/10/19.
+//
+
+/*
+ * A row of spheres recedes from the camera, which moves back and forth along it. MeshLod builds the level chain of the
+ * sphere once, the indices of all levels share one element buffer, and each sphere is drawn at the level chosen by
+ * LodSelector for its distance. The geometry submitted at each level is shown in the window title.
+ */
+
+#include "OpenGLApp/Window.hpp"
+#include "OpenGLApp/GLObject.hpp"
+#include "OpenGLApp/MeshLod.hpp"
+#include "OpenGLApp/Program.hpp"
+
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <span>
+#include <string>
+#include <vector>
+
+#include <glm/gtc/constants.hpp>
+#include <glm/gtc/matrix_transform.hpp>
+
+#include "../models.hpp"
+
+namespace{
+    struct Mesh{
+        std::vector<VertexPN<3>> vertices;
+        std::vector<std::uint32_t> indices;
+    };
+
+    // Unit UV sphere. The first and last columns are at the same positions, as they would be split by texture
+    // coordinates.
+    Mesh createSphere(std::uint32_t segment_count, std::uint32_t ring_count){
+        Mesh mesh;
+        for (std::uint32_t ring = 0; ring <= ring_count; ++ring){
+            const float theta = glm::pi<float>() * static_cast<float>(ring) / static_cast<float>(ring_count);
+            for (std::uint32_t segment = 0; segment <= segment_count; ++segment){
+                const float phi = glm::two_pi<float>() * static_cast<float>(segment % segment_count) / static_cast<float>(segment_count);
+                const glm::vec3 position { std::sin(theta) * std::cos(phi), std::cos(theta), std::sin(theta) * std::sin(phi) };
+                mesh.vertices.push_back({ position, position });
+            }
+        }
+
+        for (std::uint32_t ring = 0; ring < ring_count; ++ring){
+            for (std::uint32_t segment = 0; segment < segment_count; ++segment){
+                const std::uint32_t top_left = ring * (segment_count + 1) + segment, top_right = top_left + 1;
+                const std::uint32_t bottom_left = top_left + segment_count + 1, bottom_right = bottom_left + 1;
+                if (ring != 0){ // Degenerate at the north pole.
+                    mesh.indices.insert(mesh.indices.end(), { top_left, top_right, bottom_left });
+                }
+                if (ring != ring_count - 1){ // Degenerate at the south pole.
+                    mesh.indices.insert(mesh.indices.end(), { top_right, bottom_right, bottom_left });
+                }
+            }
+        }
+        return mesh;
+    }
+
+    std::vector<glm::vec3> getPositions(const Mesh &mesh){
+        std::vector<glm::vec3> positions;
+        positions.reserve(mesh.vertices.size());
+        for (const VertexPN<3> &vertex : mesh.vertices){
+            positions.push_back(vertex.position);
+        }
+        return positions;
+    }
+}
+
+class App : public OpenGL::Window{
+private:
+    OpenGL::Program render_program;
+    glm::mat4 projection;
+    glm::vec3 camera_pos { 2.f, 1.f, 4.f };
+    OpenGL::PerspectiveProjection camera_projection;
+    float elapsed_time = 0.f, title_time = 0.f;
+
+    const Mesh sphere_mesh = createSphere(64, 32);
+    const OpenGL::MeshLod sphere_lod { getPositions(sphere_mesh), sphere_mesh.indices };
+    OpenGL::LodSelector lod_selector;
+    std::array<glm::mat4, 8> sphere_models;
+    std::array<std::size_t, 8> sphere_levels {}; // Selected in update().
+    struct{
+        OpenGL::VertexArray vao;
+        OpenGL::Buffer vbo, ebo;
+    } sphere;
+
+    void updateTitle() const {
+        std::string title = "Mesh LOD";
+        const std::span statistics = lod_selector.getStatistics();
+        for (std::size_t level = 0; level < statistics.size(); ++level){
+            if (statistics[level].object_count != 0){
+                title += " | LOD " + std::to_string(level) + ": " + std::to_string(statistics[level].object_count) + " objects, "
+                       + std::to_string(statistics[level].triangle_count) + " triangles";
+            }
+        }
+        glfwSetWindowTitle(window, title.c_str());
+    }
+
+    void onFramebufferSizeChanged(int width, int height) override {
+        OpenGL::Window::onFramebufferSizeChanged(width, height); // Call base class method.
+
+        projection = camera_projection.getMatrix(getFramebufferAspectRatio());
+        lod_selector.setProjection(camera_projection, static_cast<float>(height));
+    }
+
+    void update(float time_delta) override {
+        // Dolly along the row, so that the spheres switch their levels.
+        elapsed_time += time_delta;
+        camera_pos = { 2.f, 1.f, 4.f - 6.f * std::sin(0.5f * elapsed_time) };
+        const glm::mat4 view = glm::lookAt(camera_pos, camera_pos + glm::vec3(-0.1f, -0.05f, -1.f), glm::vec3(0.0f, 1.0f, 0.0f));
+        render_program.setUniform("projection_view", projection * view);
+        render_program.setUniform("view_pos", camera_pos);
+        render_program.setUniform("light.position", camera_pos);
+
+        lod_selector.beginFrame();
+        for (std::size_t index = 0; index < sphere_models.size(); ++index){
+            sphere_levels[index] = lod_selector.select(sphere_lod, sphere_models[index], camera_pos);
+        }
+
+        // Refreshing the title every frame would be unreadable.
+        title_time += time_delta;
+        if (title_time >= 0.5f){
+            title_time = 0.f;
+            updateTitle();
+        }
+    }
+
+    void draw(float interpolation_alpha) const override {
+        glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+
+        render_program.use();
+
+        // All levels share the vertices, and each is a range of the element buffer.
+        glBindVertexArray(sphere.vao.getHandle());
+        for (std::size_t index = 0; index < sphere_models.size(); ++index){
+            render_program.setUniform("model", sphere_models[index]);
+            render_program.setUniform("inv_model", glm::inverse(sphere_models[index]));
+
+            const OpenGL::MeshLod::Level &level = sphere_lod.getLevel(sphere_levels[index]);
+            glDrawElements(GL_TRIANGLES, static_cast<GLsizei>(level.index_count), GL_UNSIGNED_INT,
+                           reinterpret_cast<const void*>(sizeof(GLuint) * level.first_index));
+        }
+    }
+
+public:
+    App() : Window { 800, 480, "Mesh LOD" },
+            render_program { "shaders/mesh_lod/vert.vert", "shaders/mesh_lod/frag.frag" }
+    {
+        camera_projection.fov = glm::radians(45.0f);
+        camera_projection.near_distance = 0.1f;
+        camera_projection.far_distance = 100.0f;
+        projection = camera_projection.getMatrix(getFramebufferAspectRatio());
+        lod_selector.setProjection(camera_projection, static_cast<float>(getFramebufferSize().y));
+
+        // Spheres receding along -z, 3 units apart.
+        for (std::size_t index = 0; index < sphere_models.size(); ++index){
+            const glm::vec3 position { 0.f, 0.f, -3.f * static_cast<float>(index) };
+            sphere_models[index] = glm::translate(glm::identity<glm::mat4>(), position);
+        }
+
+        render_program.setUniform("light.ambient", glm::vec3(0.1f));
+        render_program.setUniform("light.diffuse", glm::vec3(1.f));
+        render_program.setUniform("light.specular", glm::vec3(1.f));
+        render_program.setUniform("light.constant", 1.0f);
+        render_program.setUniform("light.linear", 0.02f);
+        render_program.setUniform("light.quadratic", 1.7e-3f);
+
+        render_program.setUniform("material.ambient", glm::vec3(0.31f, 0.5f, 1.f));
+        render_program.setUniform("material.diffuse", glm::vec3(0.31f, 0.5f, 1.f));
+        render_program.setUniform("material.specular", glm::vec3(0.5f));
+        render_program.setUniform("material.shininess", 32.f);
+
+        glEnable(GL_DEPTH_TEST);
+
+        glBindVertexArray(sphere.vao.getHandle());
+
+        glBindBuffer(GL_ARRAY_BUFFER, sphere.vbo.getHandle());
+        glBufferData(GL_ARRAY_BUFFER,
+                     static_cast<GLsizeiptr>(sizeof(VertexPN<3>) * sphere_mesh.vertices.size()),
+                     sphere_mesh.vertices.data(),
+                     GL_STATIC_DRAW);
+        glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, sphere.ebo.getHandle());
+        glBufferData(GL_ELEMENT_ARRAY_BUFFER,
+                     static_cast<GLsizeiptr>(sphere_lod.getIndices().size_bytes()),
+                     sphere_lod.getIndices().data(),
+                     GL_STATIC_DRAW);
+        glVertexAttribPointer(0,
+                              3,
+                              GL_FLOAT,
+                              GL_FALSE,
+                              sizeof(VertexPN<3>),
+                              reinterpret_cast<const GLint*>(offsetof(VertexPN<3>, position)));
+        glEnableVertexAttribArray(0);
+        glVertexAttribPointer(1,
+                              3,
+                              GL_FLOAT,
+                              GL_FALSE,
+                              sizeof(VertexPN<3>),
+                              reinterpret_cast<const GLint*>(offsetof(VertexPN<3>, normal)));
+        glEnableVertexAttribArray(1);
+    }
+};
+
+int main(){
+    App{}.run();
+}
@@ -3,10 +3,19 @@
 //
 
 // You can adjust perspective matrix automatically, using onFramebufferSizeChanged() callback.
+// Shader files are hot-reloaded: edit the copied shaders in the executable folder while the app is running.
+// The cube is lit by a key light and a ring of small colored lights, which are assigned to the view frustum clusters by
+// ClusteredLighting, so that each fragment shades only the lights reaching it.
 
 #include "OpenGLApp/Window.hpp"
+#include "OpenGLApp/ClusteredLighting.hpp"
 #include "OpenGLApp/Program.hpp"
+#include "OpenGLApp/ShaderHotReloader.hpp"
 
+#include <cmath>
+#include <vector>
+
+#include <glm/gtc/constants.hpp>
 #include <glm/gtc/matrix_transform.hpp>
 
 #include "../models.hpp"
@@ -14,30 +23,47 @@
 class App : public OpenGL::Window{
 private:
     OpenGL::Program render_program;
+    OpenGL::ShaderHotReloader shader_reloader;
     glm::mat4 model, view, projection;
+    OpenGL::PerspectiveProjection camera_projection;
+    OpenGL::ClusteredLighting lighting;
+    std::vector<OpenGL::ClusteredLighting::PointLight> lights;
+    float elapsed_time = 0.f;
     struct{
-        GLuint vao;
-        GLuint vbo;
+        OpenGL::VertexArray vao;
+        OpenGL::Buffer vbo;
     } cube;
 
     void onFramebufferSizeChanged(int width, int height) override {
         OpenGL::Window::onFramebufferSizeChanged(width, height); // Call base class method.
 
-        projection = glm::perspective(glm::radians(45.0f), getAspectRatio(), 0.1f, 100.0f);
+        projection = camera_projection.getMatrix(getFramebufferAspectRatio());
         render_program.setUniform("projection_view", projection * view);
     }
 
     void update(float time_delta) override {
+        shader_reloader.poll();
+
         model = glm::rotate(model, time_delta, glm::vec3(0.0f, 1.0f, 0.0f));
         render_program.setUniform("model", model);
         render_program.setUniform("inv_model", glm::inverse(model));
+
+        // Orbit the ring lights around the cube, then assign them to the clusters.
+        elapsed_time += time_delta;
+        for (std::size_t index = 1; index < lights.size(); ++index){
+            const float angle = elapsed_time + glm::two_pi<float>() * static_cast<float>(index) / static_cast<float>(lights.size() - 1);
+            lights[index].position = { 1.2f * std::cos(angle), 0.8f * std::sin(3.f * angle), 1.2f * std::sin(angle) };
+        }
+        lighting.update(lights, view, camera_projection, getFramebufferSize());
+        lighting.setUniforms(render_program, 0);
     }
 
-    void draw() const override {
+    void draw(float interpolation_alpha) const override {
         glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
 
+        lighting.bind(0);
         render_program.use();
-        glBindVertexArray(cube.vao);
+        glBindVertexArray(cube.vao.getHandle());
         glDrawArrays(GL_TRIANGLES, 0, static_cast<GLsizei>(models::normal_cube.size()));
     }
 
@@ -45,24 +71,42 @@ public:
     App() : Window { 800, 480, "Hello Triangle" },
             render_program { "shaders/rotating_cube/vert.vert", "shaders/rotating_cube/frag.frag" }
     {
+        shader_reloader.watch(render_program, "shaders/rotating_cube/vert.vert", "shaders/rotating_cube/frag.frag");
+
         constexpr glm::vec3 camera_pos { 3.f };
 
         model = glm::identity<glm::mat4>();
         view = glm::lookAt(camera_pos, glm::vec3(0.f), glm::vec3(0.0f, 1.0f, 0.0f));
-        projection = glm::perspective(glm::radians(45.0f), getAspectRatio(), 0.1f, 100.0f);
+        camera_projection.fov = glm::radians(45.0f);
+        camera_projection.near_distance = 0.1f;
+        camera_projection.far_distance = 100.0f;
+        projection = camera_projection.getMatrix(getFramebufferAspectRatio());
         render_program.setUniform("model", model);
         render_program.setUniform("inv_model", glm::inverse(model));
         render_program.setUniform("projection_view", projection * view);
 
         render_program.setUniform("view_pos", camera_pos);
 
-        render_program.setUniform("light.position", glm::vec3(0.f, -1.f, 2.f));
-        render_program.setUniform("light.ambient", glm::vec3(0.1f));
-        render_program.setUniform("light.diffuse", glm::vec3(1.f));
-        render_program.setUniform("light.specular", glm::vec3(1.f));
-        render_program.setUniform("light.constant", 1.0f);
-        render_program.setUniform("light.linear", 0.02f);
-        render_program.setUniform("light.quadratic", 1.7e-3f);
+        // Key light, whose radius covers the whole scene.
+        lights.push_back({
+            .position = { 0.f, -1.f, 2.f }, .radius = 100.f,
+            .ambient = glm::vec3 { 0.1f }, .constant = 1.f,
+            .diffuse = glm::vec3 { 1.f }, .linear = 0.02f,
+            .specular = glm::vec3 { 1.f }, .quadratic = 1.7e-3f,
+        });
+
+        // Ring lights, whose positions are set in update().
+        constexpr std::size_t ring_light_count = 64;
+        for (std::size_t index = 0; index < ring_light_count; ++index){
+            const float hue = glm::two_pi<float>() * static_cast<float>(index) / ring_light_count;
+            const glm::vec3 color = glm::vec3 { std::cos(hue), std::cos(hue - 2.094f), std::cos(hue + 2.094f) } * 0.5f + 0.5f;
+            lights.push_back({
+                .radius = 1.f,
+                .ambient = glm::vec3 { 0.f }, .constant = 1.f,
+                .diffuse = color, .linear = 4.5f,
+                .specular = color, .quadratic = 75.f,
+            });
+        }
 
         render_program.setUniform("material.ambient", glm::vec3(1.f, 0.5f, 0.31f));
         render_program.setUniform("material.diffuse", glm::vec3(1.f, 0.5f, 0.31f));
@@ -71,11 +115,9 @@ public:
 
         glEnable(GL_DEPTH_TEST);
 
-        glGenVertexArrays(1, &cube.vao);
-        glBindVertexArray(cube.vao);
+        glBindVertexArray(cube.vao.getHandle());
 
-        glGenBuffers(1, &cube.vbo);
-        glBindBuffer(GL_ARRAY_BUFFER, cube.vbo);
+        glBindBuffer(GL_ARRAY_BUFFER, cube.vbo.getHandle());
         glBufferData(GL_ARRAY_BUFFER,
                      static_cast<GLsizei>(sizeof(VertexPN<3>) * models::normal_cube.size()),
                      models::normal_cube.data(),
@@ -95,11 +137,6 @@ public:
                               reinterpret_cast<const GLint*>(offsetof(VertexPN<3>, normal)));
         glEnableVertexAttribArray(1);
     }
-
-    ~App() noexcept override{
-        glDeleteVertexArrays(1, &cube.vao);
-        glDeleteBuffers(1, &cube.vbo);
-    }
 };
 
 int main(){
@@ -4,8 +4,11 @@ in vec2 texCoords;
 
 out vec4 FragColor;
 
-uniform sampler2D material_texture;
+uniform sampler2D material_texture; // Texture atlas.
+uniform vec4 material_region; // (offset, scale) of the material image in the atlas.
 
 void main(){
-    FragColor = texture(material_texture, texCoords);
-}
\ No newline at end of file
+    // Wrap the texture coordinates inside the region, and use the unwrapped derivatives to avoid the seams.
+    vec2 scale = material_region.zw;
+    FragColor = textureGrad(material_texture, material_region.xy + fract(texCoords) * scale, dFdx(texCoords) * scale, dFdy(texCoords) * scale);
+}
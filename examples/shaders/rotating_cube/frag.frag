@@ -9,6 +9,7 @@ struct Material{
 
 struct PointLight {
     vec3 position;
+    float radius;
 
     vec3 ambient;
     vec3 diffuse;
@@ -26,9 +27,32 @@ out vec4 FragColor;
 
 uniform vec3 view_pos;
 uniform Material material;
-uniform PointLight light;
 
-void main(){
+// Set by OpenGL::ClusteredLighting.
+uniform samplerBuffer cluster_lights;
+uniform usamplerBuffer cluster_grid;
+uniform usamplerBuffer cluster_light_indices;
+uniform uvec3 cluster_grid_size;
+uniform vec2 cluster_tile_size;
+uniform vec4 cluster_depth_params;
+
+PointLight fetchLight(uint index){
+    vec4 texel0 = texelFetch(cluster_lights, int(4u * index));
+    vec4 texel1 = texelFetch(cluster_lights, int(4u * index + 1u));
+    vec4 texel2 = texelFetch(cluster_lights, int(4u * index + 2u));
+    vec4 texel3 = texelFetch(cluster_lights, int(4u * index + 3u));
+    return PointLight(texel0.xyz, texel0.w, texel1.xyz, texel2.xyz, texel3.xyz, texel1.w, texel2.w, texel3.w);
+}
+
+uint getClusterIndex(){
+    float near = cluster_depth_params.x, far = cluster_depth_params.y;
+    float depth = 2.0 * near * far / (far + near - (2.0 * gl_FragCoord.z - 1.0) * (far - near));
+    uvec2 tile = min(uvec2(gl_FragCoord.xy / cluster_tile_size), cluster_grid_size.xy - 1u);
+    uint slice = uint(clamp(log(depth) * cluster_depth_params.z + cluster_depth_params.w, 0.0, float(cluster_grid_size.z - 1u)));
+    return (slice * cluster_grid_size.y + tile.y) * cluster_grid_size.x + tile.x;
+}
+
+vec3 shade(PointLight light, vec3 viewDir){
     // ambient
     vec3 ambient = light.ambient * material.ambient;
 
@@ -38,15 +62,25 @@ void main(){
     vec3 diffuse = light.diffuse * (diff * material.diffuse);
 
     // specular
-    vec3 viewDir = normalize(view_pos - fragPos);
     vec3 reflectDir = reflect(-lightDir, normal);
     float spec = pow(max(dot(viewDir, reflectDir), 0.0), material.shininess);
     vec3 specular = light.specular * (spec * material.specular);
 
-    // attenuation
+    // attenuation, faded to zero at the radius where the light is culled.
     float d = distance(light.position, fragPos);
     float attenuation = 1.0 / (light.constant + light.linear*d + light.quadratic*d*d);
+    float window = clamp(1.0 - pow(d / light.radius, 4.0), 0.0, 1.0);
+
+    return attenuation * window * window * (ambient + diffuse + specular);
+}
+
+void main(){
+    vec3 viewDir = normalize(view_pos - fragPos);
 
-    vec3 result = attenuation * (ambient + diffuse + specular);
+    uvec2 cluster = texelFetch(cluster_grid, int(getClusterIndex())).xy;
+    vec3 result = vec3(0.0);
+    for (uint i = 0u; i < cluster.y; ++i){
+        result += shade(fetchLight(texelFetch(cluster_light_indices, int(cluster.x + i)).x), viewDir);
+    }
     FragColor = vec4(result, 1.0);
-}
\ No newline at end of file
+}
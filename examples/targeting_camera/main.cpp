@@ -5,19 +5,23 @@
 /*
  * Enter WASD to move the camera. It will move the target point.
  * Drag screen to rotate the camera. Camera will rotate around the target point.
+ * Press P to start counting the GL calls by GLIntercept, and press it again to print the statistics of the last frame
+ * and stop.
  */
 
 #include "OpenGLApp/Window.hpp"
 #include "OpenGLApp/Program.hpp"
 #include "OpenGLApp/Camera.hpp"
+#include "OpenGLApp/GLIntercept.hpp"
+#include "OpenGLApp/GLInterceptCore.hpp"
 #include <glm/gtc/constants.hpp>
 #include <glm/ext/matrix_transform.hpp>
+#include <iostream>
 
 #include "../models.hpp"
 
 class App : public OpenGL::Window{
 private:
-    std::optional<glm::vec2> previous_mouse_position;
     std::optional<glm::vec3> camera_velocity;
 
     const struct{
@@ -37,40 +41,6 @@ private:
         onCameraChanged();
     }
 
-    void onScrollChanged(double xoffset, double yoffset) override {
-        constexpr float min_distance = 1.f;
-        camera.view.distance = std::fmax(
-            std::exp(camera_properties.scroll_sensitivity * static_cast<float>(-yoffset)) * camera.view.distance,
-            min_distance
-        );
-        onCameraChanged();
-    }
-
-    void onMouseButtonChanged(int button, int action, int mods) override {
-        if (button == GLFW_MOUSE_BUTTON_LEFT && action == GLFW_PRESS){
-            double mouse_x, mouse_y;
-            glfwGetCursorPos(window, &mouse_x, &mouse_y);
-
-            previous_mouse_position = glm::vec2(mouse_x, mouse_y);
-        }
-        else if (button == GLFW_MOUSE_BUTTON_LEFT && action == GLFW_RELEASE){
-            previous_mouse_position = std::nullopt;
-        }
-    }
-
-    void onCursorPosChanged(double xpos, double ypos) override {
-        const glm::vec2 position { xpos, ypos };
-        if (previous_mouse_position.has_value()) {
-            const glm::vec2 offset = camera_properties.pan_sensitivity * (position - previous_mouse_position.value());
-            previous_mouse_position = position;
-
-            camera.view.addYaw(offset.x);
-            camera.view.addPitch(-offset.y);
-
-            onCameraChanged();
-        }
-    }
-
     void onKeyChanged(int key, int scancode, int action, int mods) override {
         if (action == GLFW_PRESS){
             const auto camera_front = camera.view.getFront();
@@ -90,6 +60,15 @@ private:
                 case GLFW_KEY_W:
                     camera_velocity = camera_properties.speed * camera_up;
                     break;
+                case GLFW_KEY_P:
+                    if (OpenGL::GLIntercept::isEnabled()){
+                        OpenGL::GLIntercept::dumpFrameStatistics(std::cout);
+                        OpenGL::GLIntercept::disable();
+                    }
+                    else{
+                        OpenGL::GLIntercept::enable();
+                    }
+                    break;
                 default:
                     break;
             }
@@ -100,13 +79,39 @@ private:
     }
 
     void update(float time_delta) override {
+        // Cursor and scroll events are coalesced per frame, so the camera matrices are recomputed at most once per frame
+        // regardless of the mouse polling rate.
+        const OpenGL::InputState &input = getInputState();
+        bool camera_changed = false;
+
+        if (input.scroll_delta.y != 0.0){
+            constexpr float min_distance = 1.f;
+            camera.view.distance = std::fmax(
+                std::exp(camera_properties.scroll_sensitivity * static_cast<float>(-input.scroll_delta.y)) * camera.view.distance,
+                min_distance
+            );
+            camera_changed = true;
+        }
+
+        if (input.isMouseButtonPressed(GLFW_MOUSE_BUTTON_LEFT) && input.cursor_delta != glm::dvec2 { 0.0 }){
+            const glm::vec2 offset = camera_properties.pan_sensitivity * glm::vec2 { input.cursor_delta };
+
+            camera.view.addYaw(offset.x);
+            camera.view.addPitch(-offset.y);
+            camera_changed = true;
+        }
+
         if (camera_velocity.has_value()){
             camera.view.target += time_delta * camera_velocity.value();
+            camera_changed = true;
+        }
+
+        if (camera_changed){
             onCameraChanged();
         }
     }
 
-    void draw() const override {
+    void draw(float interpolation_alpha) const override {
         glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
 
         render_program.use();
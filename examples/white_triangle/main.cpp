@@ -24,7 +24,7 @@ private:
 
     }
 
-    void draw() const override {
+    void draw(float interpolation_alpha) const override {
         glClear(GL_COLOR_BUFFER_BIT);
 
         render_program.use();
@@ -0,0 +1,38 @@
+//
+// Created by gomkyung2 on 2026/10/19.
+//
+
+#pragma once
+
+#include <GL/glew.h>
+
+namespace OpenGL::BindlessTexture{
+    [[nodiscard]] inline bool isSupported() noexcept {
+        return GLEW_ARB_bindless_texture;
+    }
+
+    /**
+     * @brief Create a bindless handle of \p texture and make it resident.
+     * @param texture Texture handle. Its parameters and storage must not be changed afterward.
+     * @return Resident bindless handle, 0 if ARB_bindless_texture is not supported.
+     */
+    [[nodiscard]] inline GLuint64 makeResident(GLuint texture) {
+        if (!isSupported()){
+            return 0;
+        }
+
+        const GLuint64 handle = glGetTextureHandleARB(texture);
+        glMakeTextureHandleResidentARB(handle);
+        return handle;
+    }
+
+    /**
+     * @brief Make \p handle non-resident, which must be done before the texture is deleted.
+     * @param handle Handle returned by \p makeResident . Nothing is done if it is 0.
+     */
+    inline void makeNonResident(GLuint64 handle) {
+        if (handle != 0){
+            glMakeTextureHandleNonResidentARB(handle);
+        }
+    }
+}
@@ -0,0 +1,43 @@
+//
+// Created by gomkyung2 on 2026/10/19.
+//
+
+#pragma once
+
+/* SYNOPSIS.
+ *
+ * Version and optional features of the current GL context, which are queried once by Window right after the context is
+ * created (see Window::ContextSettings). Library objects check them to take the cheaper paths of newer GL versions,
+ * e.g. direct state access (glCreate*, glNamed*, glTexture*) instead of binding an object only to edit it.
+ *
+ * Each feature is available if it is in the core of the context version, or if its ARB extension is supported.
+ */
+
+#include <GL/glew.h>
+
+namespace OpenGL{
+    struct Capabilities{
+        int major_version = 0;
+        int minor_version = 0;
+        bool core_profile = false;
+
+        bool separate_shader_objects = false; // GL 4.1 or ARB_separate_shader_objects, which includes glProgramUniform*.
+        bool texture_storage = false; // GL 4.2 or ARB_texture_storage.
+        bool multi_draw_indirect = false; // GL 4.3 or ARB_multi_draw_indirect.
+        bool buffer_storage = false; // GL 4.4 or ARB_buffer_storage.
+        bool direct_state_access = false; // GL 4.5 or ARB_direct_state_access.
+
+        [[nodiscard]] bool isVersionAtLeast(int major, int minor) const noexcept;
+
+        /**
+         * @brief Query the capabilities of the current context. Window calls it after GLEW is initialized.
+         */
+        static void detect();
+
+        /**
+         * @brief Get the capabilities detected by the last \p detect .
+         * @return Capabilities, every feature of which is \p false before the first \p detect .
+         */
+        [[nodiscard]] static const Capabilities &get() noexcept;
+    };
+}
@@ -0,0 +1,131 @@
+//
+// Created by gomkyung2 on 2026/10/19.
+//
+
+#pragma once
+
+/* SYNOPSIS.
+ *
+ * Clustered forward lighting: the view frustum is split into a grid of clusters, uniform in screen space (x, y) and
+ * exponential in view depth (z). Every frame, update() assigns each point light to the clusters its sphere of influence
+ * overlaps, and uploads the lights and the per-cluster light lists into buffer textures. The fragment shader looks up
+ * its cluster from gl_FragCoord and shades only the lights in it, so the per-pixel cost depends on the lights which
+ * actually reach the pixel rather than on the total number of lights.
+ *
+ * Light assignment runs on the CPU in parallel, one depth slice per task. Each slice first keeps the lights whose
+ * depth range overlaps the slice, then tests them against the AABB of each cluster in the slice, four lights at a time
+ * with SSE.
+ *
+ * Shader interface (set by setUniforms(), and the buffer textures are bound by bind()):
+ *
+ *     uniform samplerBuffer cluster_lights;        // 4 RGBA32F texels per light, laid out as PointLight.
+ *     uniform usamplerBuffer cluster_grid;         // RG32UI (offset, count) per cluster, x fastest then y, then z.
+ *     uniform usamplerBuffer cluster_light_indices; // R32UI light indices, referenced by cluster_grid.
+ *     uniform uvec3 cluster_grid_size;
+ *     uniform vec2 cluster_tile_size;              // Size of a cluster on the screen in pixels.
+ *     uniform vec4 cluster_depth_params;           // (near, far, slice scale, slice bias).
+ *
+ *     float d = 2.0 * near * far / (far + near - (2.0 * gl_FragCoord.z - 1.0) * (far - near)); // View depth.
+ *     uvec3 cluster = uvec3(uvec2(gl_FragCoord.xy / cluster_tile_size), uint(clamp(log(d) * scale + bias, 0.0, float(cluster_grid_size.z - 1u))));
+ *
+ * Lights are in world space. A light contributes nothing beyond its radius, so the shader should fade its attenuation
+ * to zero at the radius.
+ */
+
+#include <cstddef>
+#include <span>
+#include <vector>
+
+#include <GL/glew.h>
+#include <glm/ext/matrix_float4x4.hpp>
+#include <glm/ext/vector_float2.hpp>
+#include <glm/ext/vector_float3.hpp>
+#include <glm/ext/vector_float4.hpp>
+#include <glm/ext/vector_int2.hpp>
+#include <glm/ext/vector_uint2.hpp>
+#include <glm/ext/vector_uint3.hpp>
+
+#include "Camera.hpp"
+#include "GLObject.hpp"
+#include "Program.hpp"
+#include "Utils/ThreadPool.hpp"
+
+namespace OpenGL{
+    class ClusteredLighting{
+    public:
+        // Same layout as the cluster_lights texels.
+        struct PointLight{
+            glm::vec3 position;
+            float radius; // Distance beyond which the light is culled.
+            glm::vec3 ambient;
+            float constant;
+            glm::vec3 diffuse;
+            float linear;
+            glm::vec3 specular;
+            float quadratic;
+        };
+
+        struct Statistics{
+            std::size_t light_count;
+            std::size_t index_count; // Total light references in the clusters.
+            std::size_t max_lights_per_cluster;
+            std::size_t empty_cluster_count;
+        };
+
+    private:
+        glm::uvec3 grid_size;
+        glm::vec2 tile_size;
+        glm::vec4 depth_params;
+
+        Buffer light_buffer, grid_buffer, index_buffer;
+        Texture light_texture, grid_texture, index_texture;
+
+        std::vector<glm::uvec2> grid; // (offset, count) per cluster.
+        std::vector<GLuint> indices;
+        std::vector<std::vector<GLuint>> slice_indices; // Per depth slice, filled in parallel.
+        Statistics statistics {};
+
+    public:
+        /**
+         * @brief Create the buffers and their buffer textures.
+         * @param grid_size Number of clusters in screen x, screen y and view depth.
+         */
+        explicit ClusteredLighting(glm::uvec3 grid_size = { 16, 9, 24 });
+
+        /**
+         * @brief Assign \p lights to the clusters of the view frustum and upload them. Call it once per frame in the GL
+         * thread, after the camera is moved.
+         * @param lights Point lights in world space.
+         * @param view View matrix.
+         * @param projection Perspective projection of the camera.
+         * @param framebuffer_size Size of the framebuffer in pixels. If it is empty (e.g. the window is minimized), the
+         * previous clusters are kept.
+         * @param thread_pool Thread pool to assign the depth slices in parallel.
+         */
+        void update(std::span<const PointLight> lights, const glm::mat4 &view, const PerspectiveProjection &projection,
+                    glm::ivec2 framebuffer_size, Utils::ThreadPool &thread_pool = Utils::ThreadPool::getDefault());
+
+        /**
+         * @brief Assign \p lights to the clusters of \p camera 's view frustum and upload them.
+         * @see update
+         */
+        void update(std::span<const PointLight> lights, const PerspectiveCamera &camera, glm::ivec2 framebuffer_size,
+                    Utils::ThreadPool &thread_pool = Utils::ThreadPool::getDefault());
+
+        /**
+         * @brief Bind the buffer textures to the three consecutive texture units from \p first_texture_unit .
+         * @param first_texture_unit First texture unit, e.g. 0 for GL_TEXTURE0.
+         * @note The active texture unit is changed.
+         */
+        void bind(GLuint first_texture_unit) const;
+
+        /**
+         * @brief Set the uniforms of the shader interface to \p program .
+         * @param program Program which uses the clustered lights.
+         * @param first_texture_unit First texture unit which is passed to \p bind .
+         */
+        void setUniforms(const Program &program, GLuint first_texture_unit) const;
+
+        [[nodiscard]] const Statistics &getStatistics() const noexcept;
+    };
+}
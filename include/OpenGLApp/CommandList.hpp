@@ -0,0 +1,170 @@
+//
+// Created by gomkyung2 on 2026/10/19.
+//
+
+#pragma once
+
+/* SYNOPSIS.
+ *
+ * CommandList records program uses, uniform writes, binds and draw calls without calling any GL function, so a frame's
+ * command stream can be built by multiple threads in parallel (e.g. each worker records the objects of its range into
+ * its own list). The GL thread then replays the lists by execute(), in an order decided by the application rather than
+ * by the thread scheduling, e.g. the index of the worker.
+ *
+ * Commands are allocated by the list's own LinearAllocator, so recording does not touch the global heap once the chunks
+ * are warmed up, and clear() recycles the memory for the next frame. A list must be recorded by only one thread at a
+ * time, which makes the allocator effectively per-thread.
+ *
+ * Program uses and uniform writes are replayed through OpenGL::State, so redundant glUseProgram calls are skipped and
+ * uniforms of unused programs are queued as usual. Uniform locations must be resolved in advance (e.g. by
+ * Program::getUniformLocation in the constructor), since the lookup is not thread-safe.
+ */
+
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+
+#include <GL/glew.h>
+
+#include "Program.hpp"
+#include "State.hpp"
+#include "Utils/LinearAllocator.hpp"
+
+namespace OpenGL{
+    class CommandList{
+    private:
+        struct Command{
+            void (*execute)(const Command &command);
+            Command *next;
+        };
+
+        struct UseProgramCommand : Command{
+            GLuint program;
+            void run() const;
+        };
+
+        template <typename T>
+        struct UniformCommand : Command{
+            GLuint program;
+            GLint location;
+            T value;
+            void run() const;
+        };
+
+        struct BindVertexArrayCommand : Command{
+            GLuint vertex_array;
+            void run() const;
+        };
+
+        struct BindTextureCommand : Command{
+            GLuint unit;
+            GLenum target;
+            GLuint texture;
+            void run() const;
+        };
+
+        struct BindBufferBaseCommand : Command{
+            GLenum target;
+            GLuint index;
+            GLuint buffer;
+            void run() const;
+        };
+
+        struct DrawArraysCommand : Command{
+            GLenum mode;
+            GLint first;
+            GLsizei count;
+            GLsizei instance_count;
+            void run() const;
+        };
+
+        struct DrawElementsCommand : Command{
+            GLenum mode;
+            GLsizei count;
+            GLenum type;
+            std::uintptr_t offset;
+            GLsizei instance_count;
+            void run() const;
+        };
+
+        Utils::LinearAllocator allocator;
+        Command *head = nullptr, *tail = nullptr;
+        std::size_t command_count = 0;
+
+        template <typename C>
+        void append(C &&command);
+
+    public:
+        CommandList() = default;
+        CommandList(const CommandList&) = delete;
+        CommandList(CommandList &&source) noexcept;
+        CommandList &operator=(CommandList &&source) noexcept;
+
+        void useProgram(GLuint program);
+        void useProgram(const Program &program);
+
+        /**
+         * @brief Record a uniform write, which is replayed by \p OpenGL::State::setUniform .
+         * @param program Program handle.
+         * @param location Uniform location, resolved in advance. The write is dropped if it is -1.
+         * @param value Value to set. Its type must be one of the types accepted by \p OpenGL::State::setUniform .
+         */
+        template <typename T> requires requires (GLuint program, GLint location, T value) { State::setUniform(program, location, std::move(value)); }
+        void setUniform(GLuint program, GLint location, const T &value);
+
+        void bindVertexArray(GLuint vertex_array);
+
+        /**
+         * @brief Record a texture bind to the texture unit \p unit (i.e. \p GL_TEXTURE0 + \p unit ).
+         */
+        void bindTexture(GLuint unit, GLenum target, GLuint texture);
+
+        void bindBufferBase(GLenum target, GLuint index, GLuint buffer);
+
+        void drawArrays(GLenum mode, GLint first, GLsizei count, GLsizei instance_count = 1);
+
+        /**
+         * @brief Record an indexed draw call, using the element array buffer of the bound vertex array.
+         * @param offset Byte offset of the first index in the element array buffer.
+         */
+        void drawElements(GLenum mode, GLsizei count, GLenum type, std::uintptr_t offset = 0, GLsizei instance_count = 1);
+
+        /**
+         * @brief Replay the recorded commands in the recorded order. Must be called in the GL thread.
+         * @note The commands are kept, so the list can be executed multiple times until \p clear .
+         */
+        void execute() const;
+
+        /**
+         * @brief Remove every command. The memory is kept for the subsequent recordings.
+         */
+        void clear() noexcept;
+
+        [[nodiscard]] std::size_t size() const noexcept;
+        [[nodiscard]] bool empty() const noexcept;
+    };
+}
+
+template <typename C>
+void OpenGL::CommandList::append(C &&command) {
+    C *const recorded = allocator.create<C>(std::forward<C>(command));
+    recorded->execute = [](const Command &command) { static_cast<const C&>(command).run(); };
+    recorded->next = nullptr;
+
+    (tail ? tail->next : head) = recorded;
+    tail = recorded;
+    ++command_count;
+}
+
+template <typename T>
+void OpenGL::CommandList::UniformCommand<T>::run() const {
+    State::setUniform(program, location, T { value });
+}
+
+template <typename T> requires requires (GLuint program, GLint location, T value) { OpenGL::State::setUniform(program, location, std::move(value)); }
+void OpenGL::CommandList::setUniform(GLuint program, GLint location, const T &value) {
+    if (location == -1){
+        return;
+    }
+    append(UniformCommand<T> { {}, program, location, value });
+}
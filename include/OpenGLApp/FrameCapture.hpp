@@ -0,0 +1,121 @@
+//
+// Created by gomkyung2 on 2026/10/19.
+//
+
+#pragma once
+
+/* SYNOPSIS.
+ *
+ * FrameCapture reads framebuffers back without stalling the pipeline. capture() issues glReadPixels into a pixel buffer
+ * object of a ring and puts a fence after it, then returns immediately. poll(), called once per frame, maps the buffers
+ * whose fences are signaled (usually a frame or two later), and hands the pixels to a worker thread which runs the
+ * callback, e.g. PNG encoding by writeFile().
+ *
+ *     FrameCapture frame_capture;
+ *     // In draw(), before the buffers are swapped:
+ *     frame_capture.captureToFile(0, GL_BACK, getFramebufferSize(), "screenshot.png");
+ *     frame_capture.poll();
+ */
+
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <filesystem>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include <GL/glew.h>
+#include <glm/vec2.hpp>
+
+namespace OpenGL{
+    class FrameCapture{
+    public:
+        struct Frame{
+            int width;
+            int height;
+            std::vector<unsigned char> pixels; // RGBA8, top row first. Empty if the pixels could not be read back.
+
+            /**
+             * @brief Check if the pixels were read back.
+             * @return \p false if the pixel buffer could not be mapped, in which case \p pixels is empty.
+             */
+            [[nodiscard]] bool isValid() const noexcept;
+        };
+
+        // Called in the worker thread, and must not throw. The frame is invalid if the read back failed.
+        using Callback = std::function<void(Frame&&)>;
+
+    private:
+        struct Slot{
+            GLuint buffer;
+            GLsync fence = nullptr; // nullptr if not pending.
+            glm::ivec2 size;
+            Callback callback;
+        };
+
+        std::vector<Slot> slots;
+        std::size_t next_slot = 0;
+
+        std::mutex mutex;
+        std::condition_variable_any condition;
+        std::deque<std::function<void()>> tasks;
+        std::jthread worker; // Must be declared last, since the worker uses the members above.
+
+        void complete(Slot &slot);
+        void workerMain(std::stop_token stop_token);
+
+    public:
+        /**
+         * @brief Create the pixel buffer objects and start the worker thread. Must be called in the GL thread.
+         * @param ring_size Number of captures which can be in flight. If a capture is requested while all of them are
+         * in flight, it waits for the oldest one.
+         */
+        explicit FrameCapture(std::size_t ring_size = 3);
+        FrameCapture(const FrameCapture&) = delete;
+
+        /**
+         * @brief Complete the pending captures and wait for the worker to run their callbacks.
+         */
+        ~FrameCapture() noexcept;
+
+        /**
+         * @brief Read the color buffer asynchronously. Must be called in the GL thread.
+         * @param framebuffer Framebuffer to be read, 0 for the default framebuffer.
+         * @param read_buffer Color buffer to be read, e.g. \p GL_BACK for the default framebuffer (before swapping the
+         * buffers) or \p GL_COLOR_ATTACHMENT0 .
+         * @param size Size of the region from the lower left corner.
+         * @param callback Function which receives the pixels in the worker thread.
+         * @note The read framebuffer binding is restored afterward.
+         */
+        void capture(GLuint framebuffer, GLenum read_buffer, glm::ivec2 size, Callback callback);
+
+        /**
+         * @brief Read the color buffer asynchronously and write it to \p filename in the worker thread.
+         * @param filename Output file name. PNG if the extension is ".png", otherwise raw RGBA8 pixels.
+         * @see capture
+         */
+        void captureToFile(GLuint framebuffer, GLenum read_buffer, glm::ivec2 size, std::filesystem::path filename);
+
+        /**
+         * @brief Complete the captures which are finished in GPU, without waiting. Call it once per frame.
+         */
+        void poll();
+
+        /**
+         * @brief Complete every pending capture, waiting for the GPU.
+         */
+        void flush();
+
+        [[nodiscard]] std::size_t getPendingCount() const noexcept;
+
+        /**
+         * @brief Write \p frame to \p filename .
+         * @param frame Captured frame.
+         * @param filename Output file name. PNG if the extension is ".png", otherwise raw RGBA8 pixels.
+         * @return \p true if written successfully, \p false otherwise, e.g. if \p frame is invalid.
+         */
+        static bool writeFile(const Frame &frame, const std::filesystem::path &filename);
+    };
+}
@@ -0,0 +1,82 @@
+//
+// Created by gomkyung2 on 2026/10/19.
+//
+
+#pragma once
+
+/* SYNOPSIS.
+ *
+ * Opt-in GL call interception for profiling how many GL calls, state changes, draw calls and uploaded bytes each
+ * frame produces.
+ *
+ * GLEW calls every entry point after GL 1.1 through a global function pointer (glUseProgram is a macro expanded to
+ * __glewUseProgram). enable() saves these pointers and replaces them with wrappers which update the statistics and
+ * forward the call; disable() restores them. Therefore, when interception is disabled, there is no overhead at all:
+ * the calls go directly to the driver as usual. The direct state access variants (glCreate*, glNamedBuffer*,
+ * glTexture*) the library uses when available are intercepted too, so the object creations and uploaded bytes are
+ * counted regardless of which path is taken.
+ *
+ * GL 1.0/1.1 entry points (glDrawArrays, glDrawElements, glBindTexture, glTexImage2D, ...) are exported directly by the
+ * system GL library, and cannot be intercepted in this way. Translation units which want them to be counted should
+ * include GLInterceptCore.hpp after the GL headers, which routes them through swappable function pointers like GLEW
+ * does for the others. The library translation units which draw, bind or upload textures (RenderQueue, CommandList,
+ * the texture classes, ...) include it, so only the application's own calls need it.
+ *
+ * Statistics are accumulated until endFrame(), which is called by Window after each swap while interception is enabled.
+ * The redundancy detection tracks the bindings since enable(), so bindings made before it are unknown and the first
+ * bind of each target is never reported as redundant. Uniform values are tracked per program, for glUniform* by the
+ * program in use and for glProgramUniform* (see State.hpp) by the given one.
+ */
+
+#include <cstddef>
+#include <ostream>
+#include <string_view>
+#include <vector>
+
+namespace OpenGL::GLIntercept{
+    struct CallCount{
+        std::string_view name; // Entry point name, e.g. "glUseProgram".
+        std::size_t count;
+    };
+
+    struct FrameStatistics{
+        std::vector<CallCount> call_counts; // Only the entry points called at least once, in descending order of count.
+        std::size_t total_calls = 0;
+        std::size_t draw_calls = 0;
+        std::size_t state_changes = 0; // Program, buffer, VAO, texture and framebuffer binds which changed the binding.
+        std::size_t redundant_binds = 0; // Binds to the already bound object.
+        std::size_t uniform_sets = 0;
+        std::size_t redundant_uniform_sets = 0; // Uniform sets with the same value as the previous one, or to location -1.
+        std::size_t buffer_upload_bytes = 0;
+        std::size_t texture_upload_bytes = 0;
+    };
+
+    /**
+     * @brief Install the interception wrappers. Must be called in the GL thread after GLEW is initialized.
+     */
+    void enable();
+
+    /**
+     * @brief Restore the original GL function pointers.
+     */
+    void disable();
+
+    [[nodiscard]] bool isEnabled() noexcept;
+
+    /**
+     * @brief Finish the current frame: its statistics become available by getFrameStatistics(), and the counters are reset.
+     */
+    void endFrame();
+
+    /**
+     * @brief Get the statistics of the last finished frame.
+     * @return Frame statistics.
+     */
+    [[nodiscard]] const FrameStatistics &getFrameStatistics() noexcept;
+
+    /**
+     * @brief Write the statistics of the last finished frame in human readable form.
+     * @param stream Output stream.
+     */
+    void dumpFrameStatistics(std::ostream &stream);
+}
@@ -0,0 +1,37 @@
+//
+// Created by gomkyung2 on 2026/10/19.
+//
+
+#pragma once
+
+/*
+ * Routes the GL 1.0/1.1 entry points which matter for profiling through function pointers, so that GLIntercept can
+ * count them (see GLIntercept.hpp). Include this header after <GL/glew.h> in the translation units to be profiled.
+ * While interception is disabled, the pointers refer to the original functions, which costs an indirect call like any
+ * GLEW entry point.
+ */
+
+#include <GL/glew.h>
+
+#define OPENGLAPP_GL_INTERCEPT_CORE_ENTRIES(X) \
+    X(DrawArrays) X(DrawElements) X(BindTexture) X(DeleteTextures) X(TexImage2D) X(TexSubImage2D) X(Clear) X(Enable) \
+    X(Disable)
+
+namespace OpenGL::GLIntercept::core{
+#define OPENGLAPP_DECLARE_CORE_ENTRY(name) extern decltype(&::gl##name) name;
+    OPENGLAPP_GL_INTERCEPT_CORE_ENTRIES(OPENGLAPP_DECLARE_CORE_ENTRY)
+#undef OPENGLAPP_DECLARE_CORE_ENTRY
+}
+
+// Defined by GLIntercept.cpp, which needs the original functions.
+#ifndef OPENGLAPP_GL_INTERCEPT_NO_MACROS
+#define glDrawArrays OpenGL::GLIntercept::core::DrawArrays
+#define glDrawElements OpenGL::GLIntercept::core::DrawElements
+#define glBindTexture OpenGL::GLIntercept::core::BindTexture
+#define glDeleteTextures OpenGL::GLIntercept::core::DeleteTextures
+#define glTexImage2D OpenGL::GLIntercept::core::TexImage2D
+#define glTexSubImage2D OpenGL::GLIntercept::core::TexSubImage2D
+#define glClear OpenGL::GLIntercept::core::Clear
+#define glEnable OpenGL::GLIntercept::core::Enable
+#define glDisable OpenGL::GLIntercept::core::Disable
+#endif
@@ -0,0 +1,123 @@
+//
+// Created by gomkyung2 on 2026/10/19.
+//
+
+#pragma once
+
+/* SYNOPSIS.
+ *
+ * RAII wrappers of the GL objects which are created and deleted often: Buffer, VertexArray, Texture, Framebuffer and
+ * Renderbuffer.
+ *
+ * Handles are taken from ObjectPool, which generates them by glGen* in batches rather than one by one. If direct state
+ * access is supported (see Capabilities.hpp), every type but Texture is created by glCreate* instead, so the objects can
+ * be edited by glNamed* without being bound first.
+ *
+ * Destroying a wrapper does not call glDelete* right away, since deleting an object which the GPU may still be using can
+ * make the driver synchronize in the middle of the frame. Instead, the handle is queued for the current frame, and
+ * ObjectPool::endFrame(), called by Window after each swap, puts a fence after the frame. The handles of a frame are
+ * deleted together, by one glDelete* call per type, once its fence is signaled.
+ *
+ *     OpenGL::Buffer vbo;
+ *     glBindBuffer(GL_ARRAY_BUFFER, vbo.getHandle());
+ *     ...
+ *     vbo = OpenGL::Buffer{}; // Previous buffer is deleted after the GPU finished the current frame.
+ *
+ * Every function must be called in the GL thread. The pool is shared by the process, which is assumed to have a single
+ * context (or contexts sharing their objects).
+ */
+
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+
+#include <GL/glew.h>
+
+namespace OpenGL{
+    enum class ObjectType : std::uint8_t{
+        Buffer,
+        VertexArray,
+        Texture,
+        Framebuffer,
+        Renderbuffer,
+    };
+
+    namespace ObjectPool{
+        struct Statistics{
+            std::size_t generated_handles; // Total handles generated by glGen*.
+            std::size_t free_handles; // Generated handles which are not in use.
+            std::size_t pending_deletions; // Released handles waiting for their frame's fence.
+            std::size_t deleted_handles; // Total handles deleted by glDelete*.
+        };
+
+        /**
+         * @brief Take an unused handle of \p type , generating a batch of handles if there are none.
+         * @param type Type of the object.
+         * @return Handle, whose object is created by the first bind as usual, or already created if it is made by glCreate*.
+         */
+        GLuint acquire(ObjectType type);
+
+        /**
+         * @brief Queue \p handle to be deleted after the GPU finished the current frame.
+         * @param type Type of the object.
+         * @param handle Handle acquired by \p acquire . 0 is ignored.
+         */
+        void release(ObjectType type, GLuint handle);
+
+        /**
+         * @brief Put a fence after the current frame's released handles, and delete the handles of the frames which the
+         * GPU finished. Window calls it after each swap.
+         */
+        void endFrame();
+
+        /**
+         * @brief Wait for the GPU, then delete every released handle and every unused pooled handle. Window calls it
+         * before destroying the context.
+         */
+        void flush();
+
+        [[nodiscard]] Statistics getStatistics() noexcept;
+    }
+
+    template <ObjectType type>
+    class GLObject{
+    private:
+        GLuint handle;
+
+    public:
+        GLObject() : handle { ObjectPool::acquire(type) } {
+
+        }
+
+        GLObject(const GLObject&) = delete;
+
+        GLObject(GLObject &&source) noexcept : handle { std::exchange(source.handle, 0) } {
+
+        }
+
+        GLObject &operator=(GLObject &&source) noexcept {
+            if (this != &source){
+                ObjectPool::release(type, std::exchange(handle, std::exchange(source.handle, 0)));
+            }
+            return *this;
+        }
+
+        ~GLObject() noexcept {
+            ObjectPool::release(type, handle);
+        }
+
+        /**
+         * @brief Get the OpenGL handle of the object.
+         * @return Handle, or 0 if the object is moved.
+         */
+        [[nodiscard]] GLuint getHandle() const noexcept {
+            return handle;
+        }
+    };
+
+    using Buffer = GLObject<ObjectType::Buffer>;
+    using VertexArray = GLObject<ObjectType::VertexArray>;
+    using Texture = GLObject<ObjectType::Texture>;
+    using Framebuffer = GLObject<ObjectType::Framebuffer>;
+    using Renderbuffer = GLObject<ObjectType::Renderbuffer>;
+}
@@ -0,0 +1,92 @@
+//
+// Created by gomkyung2 on 2026/10/19.
+//
+
+#pragma once
+
+/* SYNOPSIS.
+ *
+ * Golden image test mode of Window, for catching rendering regressions of the examples. When the OPENGLAPP_GOLDEN_DIR
+ * environment variable is set, Window renders a fixed number of frames with a constant time delta, captures the last
+ * frame by FrameCapture and closes itself. run() then compares the frame with the reference image
+ * <OPENGLAPP_GOLDEN_DIR>/<name>.png and throws if they differ. The name is OPENGLAPP_GOLDEN_NAME if set, otherwise the
+ * window title.
+ *
+ * Environment variables:
+ * - OPENGLAPP_GOLDEN_DIR: Directory of the reference images. The test mode is enabled only if it is set.
+ * - OPENGLAPP_GOLDEN_NAME: Name of the reference image, e.g. the test name. Default is the window title.
+ * - OPENGLAPP_GOLDEN_FRAMES: Number of frames to render before the capture. Default is 60.
+ * - OPENGLAPP_GOLDEN_TOLERANCE: Maximum per-channel difference of a matching pixel. Default is 2.
+ * - OPENGLAPP_GOLDEN_MAX_MISMATCH: Maximum ratio of mismatching pixels. Default is 0.001.
+ * - OPENGLAPP_GOLDEN_UPDATE: If 1, the captured frame is written as the new reference instead of being compared.
+ *
+ * On failure, the captured frame is written next to the reference as <name>.actual.png.
+ *
+ * The references depend on the driver, so they are not in the repository. Create them on the reference machine by
+ * building the update_golden_images target (or running the tests with OPENGLAPP_GOLDEN_UPDATE=1) once, after checking
+ * the renderings by eye.
+ */
+
+#include <filesystem>
+#include <future>
+#include <memory>
+#include <string>
+#include <string_view>
+
+#include <glm/vec2.hpp>
+
+#include "FrameCapture.hpp"
+
+namespace OpenGL{
+    class GoldenImageTest{
+    public:
+        struct Options{
+            std::filesystem::path reference_filename;
+            unsigned int frame_count = 60;
+            int tolerance = 2;
+            float max_mismatch_ratio = 1e-3f;
+            bool update = false;
+        };
+
+    private:
+        Options options;
+        unsigned int frame = 0;
+        std::promise<void> result; // Set by the worker thread of frame_capture.
+        std::future<void> result_future = result.get_future();
+        FrameCapture frame_capture { 1 }; // Must be declared last, since its worker sets the result.
+
+        void compare(FrameCapture::Frame &&frame_data);
+
+    public:
+        explicit GoldenImageTest(Options options);
+
+        /**
+         * @brief Create the test by the environment variables, if OPENGLAPP_GOLDEN_DIR is set.
+         * @param name Name of the test, e.g. the window title, used if OPENGLAPP_GOLDEN_NAME is not set. Characters
+         * which are not allowed in file names are replaced with '_'.
+         * @return Test, or \p nullptr if the test mode is disabled.
+         */
+        static std::unique_ptr<GoldenImageTest> fromEnvironment(std::string_view name);
+
+        /**
+         * @brief Get the constant time delta used instead of the measured one, so that the frames are reproducible.
+         * @return 1/60 seconds.
+         */
+        [[nodiscard]] static float getTimeDelta() noexcept;
+
+        /**
+         * @brief Count a frame, and capture the back buffer of the default framebuffer if it is the last one. Call it
+         * in the GL thread before swapping the buffers.
+         * @param framebuffer_size Size of the default framebuffer.
+         * @return \p true if the test rendered enough frames, i.e. the window should be closed.
+         */
+        bool endFrame(glm::ivec2 framebuffer_size);
+
+        /**
+         * @brief Wait for the captured frame to be compared or written. Call it in the GL thread.
+         * @throw std::runtime_error If the frame does not match the reference, the frame could not be read back, the
+         * reference could not be read, or the test was finished before the capture.
+         */
+        void check();
+    };
+}
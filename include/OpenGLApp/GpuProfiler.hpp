@@ -0,0 +1,112 @@
+//
+// Created by gomkyung2 on 2026/10/19.
+//
+
+#pragma once
+
+/* SYNOPSIS.
+ *
+ * Reading a query result right after issuing it stalls the CPU until the GPU catches up. GpuProfiler keeps the queries
+ * of the last frame_latency frames in a ring, and reads the results of a frame only when its slot is reused, i.e.
+ * frame_latency - 1 frames later. By then the GPU has almost always finished the frame; if it has not, the frame is
+ * dropped and the previous results are kept, so reading them never stalls.
+ *
+ * Each scope records GL_TIMESTAMP queries at its begin and end (glQueryCounter), rather than a GL_TIME_ELAPSED query,
+ * since GL_TIME_ELAPSED queries cannot be nested. CPU time of the scope is measured together.
+ *
+ * Usage:
+ *     profiler.beginFrame();
+ *     {
+ *         auto scope = profiler.scope("Offscreen pass");
+ *         ...
+ *     }
+ *     profiler.endFrame();
+ *     for (const auto &result : profiler.getResults()) { ... } // Results of frame (current - frame_latency + 1).
+ */
+
+#include <array>
+#include <chrono>
+#include <span>
+#include <vector>
+
+#include <GL/glew.h>
+
+namespace OpenGL{
+    class GpuProfiler{
+    public:
+        static constexpr std::size_t frame_latency = 3;
+
+        struct Result{
+            const char *name;
+            unsigned int depth; // Nesting depth, 0 for the outermost scopes.
+            float cpu_time; // In milliseconds.
+            float gpu_time; // In milliseconds.
+        };
+
+        /**
+         * @brief RAII object which measures from its construction to its destruction.
+         */
+        class Scope{
+        private:
+            GpuProfiler &profiler;
+            std::size_t marker_index;
+
+        public:
+            Scope(GpuProfiler &profiler, const char *name);
+            Scope(const Scope&) = delete;
+            ~Scope() noexcept;
+        };
+
+    private:
+        struct Marker{
+            const char *name;
+            unsigned int depth;
+            GLuint begin_query, end_query;
+            std::chrono::steady_clock::time_point cpu_begin, cpu_end;
+        };
+
+        struct Frame{
+            std::vector<Marker> markers;
+            std::vector<GLuint> queries; // Query pool of the frame, reused when the frame slot is reused.
+            std::size_t used_query_count = 0;
+        };
+
+        std::array<Frame, frame_latency> frames;
+        std::size_t frame_index = 0;
+        unsigned int current_depth = 0;
+        std::vector<Result> results;
+
+        GLuint acquireQuery();
+        void resolve(Frame &frame);
+
+    public:
+        GpuProfiler() = default;
+        GpuProfiler(const GpuProfiler&) = delete;
+        ~GpuProfiler() noexcept;
+
+        /**
+         * @brief Start a new frame. Results of the oldest frame in the ring are read back here, unless the GPU has not
+         * finished it yet.
+         */
+        void beginFrame();
+
+        /**
+         * @brief End the current frame.
+         * @note All scopes of the frame must be destroyed before this call.
+         */
+        void endFrame();
+
+        /**
+         * @brief Start a scope of \p name , which ends when the returned object is destroyed.
+         * @param name Name of the scope. Must be alive until the result is read, e.g. a string literal.
+         * @return Scope object.
+         */
+        [[nodiscard]] Scope scope(const char *name);
+
+        /**
+         * @brief Get the results of the latest resolved frame, in the order of the scope begin (pre-order).
+         * @return Results.
+         */
+        [[nodiscard]] std::span<const Result> getResults() const noexcept;
+    };
+}
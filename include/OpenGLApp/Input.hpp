@@ -0,0 +1,107 @@
+//
+// Created by gomkyung2 on 2026/10/19.
+//
+
+#pragma once
+
+/* SYNOPSIS.
+ *
+ * GLFW calls the input callbacks once per OS event, which can be hundreds of times per frame for high polling rate
+ * mice. Window does not forward them directly; events are pushed into InputEventQueue and dispatched once per frame
+ * after glfwPollEvents(). While pushing, consecutive cursor position events are merged into one (only the latest
+ * position remains), and consecutive scroll events are merged by summing their offsets. Events of other types are kept
+ * in order, so press-move-release sequences are not reordered.
+ *
+ * The result of the dispatch is also aggregated into InputState, which can be read in update() through
+ * Window::getInputState(). Its cursor and scroll deltas are summed from the end of the last update() call, so with fixed
+ * timestep only the first tick of a frame sees them, and they carry over to the next frame if no tick runs.
+ */
+
+#include <array>
+#include <bitset>
+#include <cstddef>
+#include <optional>
+#include <variant>
+
+#include <GLFW/glfw3.h>
+#include <glm/ext/vector_double2.hpp>
+
+namespace OpenGL{
+    struct KeyEvent{
+        int key, scancode, action, mods;
+    };
+
+    struct MouseButtonEvent{
+        int button, action, mods;
+    };
+
+    struct CursorPosEvent{
+        glm::dvec2 position;
+    };
+
+    struct ScrollEvent{
+        glm::dvec2 offset;
+    };
+
+    using InputEvent = std::variant<KeyEvent, MouseButtonEvent, CursorPosEvent, ScrollEvent>;
+
+    /**
+     * @brief Fixed capacity queue of input events, which coalesces consecutive cursor and scroll events.
+     */
+    class InputEventQueue{
+    public:
+        static constexpr std::size_t capacity = 256;
+
+    private:
+        std::array<InputEvent, capacity> events;
+        std::size_t size = 0;
+
+    public:
+        /**
+         * @brief Push \p event to the back of the queue, or merge it into the last event if possible.
+         * @param event Event to push.
+         * @return \p true if the event is pushed or merged, \p false if the queue is full.
+         */
+        bool push(const InputEvent &event) noexcept;
+
+        /**
+         * @brief Call \p func for each queued event in order, then clear the queue.
+         * @param func Function which takes <tt>const InputEvent&</tt>.
+         */
+        void consumeAll(auto &&func);
+
+        [[nodiscard]] bool empty() const noexcept;
+    };
+
+    /**
+     * @brief Input state aggregated from the dispatched events.
+     */
+    struct InputState{
+        std::optional<glm::dvec2> cursor_position; // Latest cursor position, std::nullopt until the cursor moved.
+        glm::dvec2 cursor_delta { 0.0 }; // Sum of cursor movement since the deltas were last consumed.
+        glm::dvec2 scroll_delta { 0.0 }; // Sum of scroll offsets since the deltas were last consumed.
+        std::bitset<GLFW_KEY_LAST + 1> pressed_keys;
+        std::bitset<GLFW_MOUSE_BUTTON_LAST + 1> pressed_mouse_buttons;
+
+        [[nodiscard]] bool isKeyPressed(int key) const noexcept;
+        [[nodiscard]] bool isMouseButtonPressed(int button) const noexcept;
+
+        /**
+         * @brief Reset the deltas after an update consumed them. Pressed states and cursor position are persisted.
+         */
+        void consumeDeltas() noexcept;
+
+        /**
+         * @brief Apply \p event to the state.
+         * @param event Event to apply.
+         */
+        void apply(const InputEvent &event) noexcept;
+    };
+}
+
+void OpenGL::InputEventQueue::consumeAll(auto &&func) {
+    for (std::size_t i = 0; i < size; ++i){
+        func(events[i]);
+    }
+    size = 0;
+}
@@ -0,0 +1,162 @@
+//
+// Created by gomkyung2 on 2026/10/19.
+//
+
+#pragma once
+
+/* SYNOPSIS.
+ *
+ * Level of detail for indexed triangle meshes. MeshLod simplifies a mesh by quadric error metric (QEM) edge collapse
+ * into a chain of levels, each with a fraction of the triangles of the previous one, and records for each level an
+ * object-space error bound. Collapses move a vertex onto one of its neighbors, so every level indexes the vertices of
+ * the original mesh: a mesh keeps its vertex buffer, the indices of all levels go into one element buffer, and a level
+ * is drawn as a range of it.
+ *
+ *     const OpenGL::MeshLod lod { positions, indices };
+ *     glNamedBufferData(element_buffer, static_cast<GLsizeiptr>(lod.getIndices().size_bytes()), lod.getIndices().data(), GL_STATIC_DRAW);
+ *
+ *     selector.setProjection(camera.projection, framebuffer_height); // When the projection or the framebuffer changes.
+ *     selector.beginFrame();
+ *     const OpenGL::MeshLod::Level &level = lod.getLevel(selector.select(lod, model, camera.view.getPosition()));
+ *     glDrawElements(GL_TRIANGLES, static_cast<GLsizei>(level.index_count), GL_UNSIGNED_INT,
+ *                    reinterpret_cast<const void*>(sizeof(GLuint) * level.first_index));
+ *
+ * Vertices at the same position (e.g. split by normals or texture coordinates) are welded while simplifying, so the
+ * attribute seams do not open. A vertex on a seam only moves along the seam, and each side keeps its own attributes.
+ * Open boundaries are kept by constraint planes.
+ *
+ * LodSelector picks the coarsest level whose error, projected onto the screen at the distance of the object, is at
+ * most a threshold in pixels, and counts the objects, triangles and vertices submitted at each level in the frame.
+ */
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+#include <glm/ext/matrix_float4x4.hpp>
+#include <glm/ext/vector_float3.hpp>
+
+#include "Camera.hpp"
+
+namespace OpenGL{
+    class MeshLod{
+    public:
+        struct Level{
+            std::uint32_t first_index; // Offset of the first index of the level in getIndices().
+            std::uint32_t index_count; // Three per triangle.
+            std::uint32_t vertex_count; // Distinct vertices referenced by the level.
+
+            // Square root of the largest quadric error of the collapses up to the level, which bounds the distance of
+            // the moved vertices from the planes of the original triangles around them. In object units, 0 for level 0.
+            float error;
+        };
+
+        struct Options{
+            std::size_t max_level_count = 8; // Including the original mesh as level 0.
+            float triangle_ratio = 0.5f; // Target triangle count of a level relative to the previous level.
+            std::size_t min_triangle_count = 16; // No level is made with fewer triangles.
+            float max_error = 1e30f; // No collapse exceeding it in object units is made.
+        };
+
+    private:
+        std::vector<std::uint32_t> indices; // Indices of all levels, from level 0.
+        std::vector<Level> levels;
+        glm::vec3 bounding_center;
+        float bounding_radius;
+
+    public:
+        /**
+         * @brief Simplify a triangle mesh into a chain of levels with the default options.
+         * @param positions Vertex positions.
+         * @param indices Triangle list indices into \p positions .
+         * @throw std::runtime_error If \p indices is not a triangle list or refers to a vertex out of \p positions .
+         */
+        MeshLod(std::span<const glm::vec3> positions, std::span<const std::uint32_t> indices);
+
+        /**
+         * @brief Simplify a triangle mesh into a chain of levels.
+         * @param positions Vertex positions.
+         * @param indices Triangle list indices into \p positions .
+         * @param options Options of the chain.
+         * @throw std::runtime_error If \p indices is not a triangle list or refers to a vertex out of \p positions .
+         * @note Simplification stops early when no more collapse is possible under \p options.max_error , or when it
+         * would flip a triangle, so there may be fewer levels than \p options.max_level_count .
+         */
+        MeshLod(std::span<const glm::vec3> positions, std::span<const std::uint32_t> indices, const Options &options);
+
+        /**
+         * @brief Get the indices of all levels, to upload into one element buffer.
+         * @return Indices into the original positions.
+         */
+        [[nodiscard]] std::span<const std::uint32_t> getIndices() const noexcept;
+
+        [[nodiscard]] std::span<const Level> getLevels() const noexcept;
+        [[nodiscard]] const Level &getLevel(std::size_t level) const noexcept;
+        [[nodiscard]] std::size_t getLevelCount() const noexcept;
+
+        // Bounding sphere of the original positions in object space.
+        [[nodiscard]] const glm::vec3 &getBoundingCenter() const noexcept;
+        [[nodiscard]] float getBoundingRadius() const noexcept;
+    };
+
+    class LodSelector{
+    public:
+        // Submitted geometry at a level in the frame. Divide by the frame time for the throughput.
+        struct LevelStatistics{
+            std::size_t object_count;
+            std::size_t triangle_count;
+            std::size_t vertex_count;
+        };
+
+    private:
+        float error_threshold;
+        float pixels_per_unit = 1.f; // Projected length in pixels of a unit length at unit distance.
+        float near_distance = 1e-2f;
+        std::vector<LevelStatistics> statistics;
+
+    public:
+        /**
+         * @brief Create a selector.
+         * @param error_threshold Largest screen-space error in pixels.
+         */
+        explicit LodSelector(float error_threshold = 1.f);
+
+        /**
+         * @brief Set the projection which the errors are projected by.
+         * @param projection Perspective projection of the camera.
+         * @param framebuffer_height Height of the framebuffer in pixels.
+         */
+        void setProjection(const PerspectiveProjection &projection, float framebuffer_height) noexcept;
+
+        void setErrorThreshold(float threshold) noexcept;
+        [[nodiscard]] float getErrorThreshold() const noexcept;
+
+        /**
+         * @brief Select the coarsest level of \p lod whose projected error is within the threshold, and count it in the
+         * statistics.
+         * @param lod Level chain of the object mesh.
+         * @param distance Distance from the camera to the bounding sphere center of the object.
+         * @param scale Largest scale of the object transform.
+         * @return Level index.
+         */
+        std::size_t select(const MeshLod &lod, float distance, float scale = 1.f);
+
+        /**
+         * @brief Select the level of \p lod for an object with \p model transform seen from \p camera_position .
+         * @see select
+         */
+        std::size_t select(const MeshLod &lod, const glm::mat4 &model, const glm::vec3 &camera_position);
+
+        /**
+         * @brief Reset the statistics. Call it once per frame before selecting.
+         */
+        void beginFrame() noexcept;
+
+        /**
+         * @brief Get the statistics of the frame.
+         * @return Statistics per level index, as long as the longest chain selected from.
+         */
+        [[nodiscard]] std::span<const LevelStatistics> getStatistics() const noexcept;
+    };
+}
@@ -0,0 +1,144 @@
+//
+// Created by gomkyung2 on 2026/10/19.
+//
+
+#pragma once
+
+/* SYNOPSIS.
+ *
+ * MipChain builds the whole mip chain of an 8-bit image in CPU, instead of glGenerateMipmap whose filter quality is up to
+ * the driver and which runs again on every upload.
+ *
+ * Filtering is done in linear light: sRGB-encoded color channels are decoded before filtering and encoded again after
+ * it, so that the coarser levels do not get darker. Alpha channels (the 2nd of gray-alpha and the 4th of RGBA images)
+ * are always linear. Each level is downsampled from the previous one by a separable filter, in parallel over row tiles
+ * with Utils::ThreadPool.
+ *
+ * The levels are uploaded to an immutable texture by createTexture() if texture storage is supported. load() stores
+ * the built chain in a cache file next to the asset (<filename>.mips), and later runs read it instead of filtering.
+ */
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <span>
+#include <vector>
+
+#include <GL/glew.h>
+
+#include "Utils/Image.hpp"
+#include "Utils/ThreadPool.hpp"
+
+namespace OpenGL{
+    class MipChain{
+    public:
+        enum class Filter : std::uint8_t{
+            Box, // 2x2 average. Fast, but a little blurry and aliased.
+            Kaiser, // 6-tap Kaiser-windowed sinc. Sharper, with less aliasing.
+        };
+
+        enum class ColorSpace : std::uint8_t{
+            Srgb,
+            Linear,
+        };
+
+        // Value-initialized options, i.e. {}, are box filtering of sRGB images.
+        struct Options{
+            Filter filter;
+            ColorSpace color_space;
+
+            bool operator==(const Options&) const noexcept = default;
+        };
+
+        struct Level{
+            int width;
+            int height;
+            std::vector<unsigned char> pixels; // Tightly packed rows.
+        };
+
+    private:
+        int channels;
+        GLenum format; // Pixel format of the levels, e.g. GL_BGRA for Utils::Image::PixelLayout::Bgra images.
+        Options options;
+        std::vector<Level> levels;
+
+        MipChain(int channels, Options options, std::vector<Level> levels) noexcept;
+
+        static std::filesystem::path getCachePath(const std::filesystem::path &filename);
+
+    public:
+        /**
+         * @brief Build the mip chain of the tightly packed 8-bit image.
+         * @param width Width of the base level.
+         * @param height Height of the base level.
+         * @param channels Number of channels, 1 to 4.
+         * @param data Pixels of the base level.
+         * @param options Filter and color space.
+         * @param thread_pool Thread pool to be used for filtering.
+         */
+        MipChain(int width, int height, int channels, const unsigned char *data, Options options = {}, Utils::ThreadPool &thread_pool = Utils::ThreadPool::getDefault());
+
+        /**
+         * @brief Build the mip chain of \p image in the color space it is tagged with.
+         * @param image 8-bit image.
+         * @param filter Downsampling filter.
+         * @param thread_pool Thread pool to be used for filtering.
+         */
+        explicit MipChain(const Utils::Image &image, Filter filter = Filter::Box, Utils::ThreadPool &thread_pool = Utils::ThreadPool::getDefault());
+
+        /**
+         * @brief Build the mip chain of \p image .
+         * @param image 8-bit image.
+         * @param options Filter and color space.
+         * @param thread_pool Thread pool to be used for filtering.
+         * @throw std::runtime_error If \p options.color_space differs from the color space \p image is tagged with.
+         */
+        MipChain(const Utils::Image &image, Options options, Utils::ThreadPool &thread_pool = Utils::ThreadPool::getDefault());
+
+        /**
+         * @brief Load the mip chain of an image file from its cache file if it is up to date, otherwise build it from
+         * the image and write the cache file.
+         * @param filename Image file name.
+         * @param options Filter and color space. The cache is rebuilt if they differ from the cached ones, or if the
+         * cached size or channels do not match the image file (e.g. a corrupt or outdated cache).
+         * @return Mip chain of the image.
+         * @throw std::runtime_error If the image could not be loaded.
+         * @note Failure of writing the cache file (e.g. in read-only directory) is ignored.
+         */
+        static MipChain load(const char *filename, Options options = {});
+
+        /**
+         * @brief Write the mip chain into \p filename .
+         * @param filename Cache file name.
+         * @param source_time Last write time of the source image, used to check if the cache is up to date.
+         * @return \p true if written successfully, \p false otherwise.
+         */
+        bool save(const std::filesystem::path &filename, std::filesystem::file_time_type source_time) const;
+
+        /**
+         * @brief Create a GL_TEXTURE_2D with every level uploaded. Must be called in the GL thread.
+         * @param internal_format Internal format of the texture. If \p GL_NONE , it is chosen by the channel count and
+         * the color space, e.g. \p GL_SRGB8_ALPHA8 for sRGB RGBA images.
+         * @return Texture handle. The caller owns it. Unless direct state access is supported, it is left bound to
+         * GL_TEXTURE_2D of the active texture unit.
+         * @note The texture is immutable (glTexStorage2D) if texture storage is supported. With direct state access, it
+         * is created and uploaded without touching the texture bindings.
+         */
+        [[nodiscard]] GLuint createTexture(GLenum internal_format = GL_NONE) const;
+
+        [[nodiscard]] int getChannels() const noexcept;
+        [[nodiscard]] std::span<const Level> getLevels() const noexcept;
+
+        /**
+         * @brief Get the pixel format of the levels, i.e. \p format argument of glTexImage2D.
+         * @return Pixel format, e.g. \p GL_RGBA .
+         */
+        [[nodiscard]] GLenum getFormat() const noexcept;
+
+        /**
+         * @brief Get the internal format chosen by the channel count and the color space.
+         * @return Internal format, e.g. \p GL_SRGB8_ALPHA8 for sRGB RGBA images.
+         */
+        [[nodiscard]] GLenum getInternalFormat() const noexcept;
+    };
+}
@@ -0,0 +1,94 @@
+//
+// Created by gomkyung2 on 2026/10/19.
+//
+
+#pragma once
+
+/* SYNOPSIS.
+ *
+ * PipelinedWindow<RenderState> runs update() of frame N+1 in a worker thread while draw() of frame N is running in the
+ * GL thread. Two RenderState snapshots are kept:
+ * - updateRenderState(time_delta, render_state) writes the back snapshot. It must not call any OpenGL function, since there is no
+ *   GL context in the worker thread. Uniform values, matrices, etc. should be written into the snapshot instead.
+ * - drawRenderState(render_state, interpolation_alpha) reads the front snapshot and issues the GL calls (including
+ *   Program::setUniform).
+ * After both finished, the snapshots are swapped and the new back snapshot is initialized by a copy of the new front
+ * snapshot, so updateRenderState() can modify the latest state incrementally.
+ *
+ * If fixed timestep is enabled, updateRenderState() may be called several times (or none) per frame on the same back
+ * snapshot, and drawRenderState() receives the interpolation factor. Keep the previous tick's values in the
+ * RenderState if they should be interpolated.
+ *
+ * Event callbacks (onKeyChanged, ...) are called in the GL thread while the worker thread is idle, so they may modify
+ * the application state and the back snapshot (through getRenderState()) freely.
+ */
+
+#include <array>
+#include <concepts>
+
+#include "Window.hpp"
+
+namespace OpenGL{
+    template <std::copyable RenderState> requires std::default_initializable<RenderState>
+    class PipelinedWindow : public Window{
+    private:
+        std::array<RenderState, 2> render_states;
+        std::size_t front_index = 0;
+
+        void update(float time_delta) final;
+        void draw(float interpolation_alpha) const final;
+        void publishRenderState() final;
+
+    protected:
+        /**
+         * @brief Update the render state of the next frame.
+         * @param time_delta Elapsed time from the previous update in seconds.
+         * @param render_state Back snapshot, initialized with the latest published render state.
+         * @note In pipelined mode, this function is called in the worker thread and must not call OpenGL functions.
+         */
+        virtual void updateRenderState(float time_delta, RenderState &render_state) = 0;
+
+        /**
+         * @brief Draw the frame using the published render state.
+         * @param render_state Front snapshot.
+         * @param interpolation_alpha Interpolation factor, see \p Window::draw .
+         */
+        virtual void drawRenderState(const RenderState &render_state, float interpolation_alpha) const = 0;
+
+        /**
+         * @brief Get the back snapshot, which will be passed to the next \p update .
+         * @return Back render state.
+         * @note Only call this function in the event callbacks or the constructor, where the worker thread is idle.
+         */
+        [[nodiscard]] RenderState &getRenderState() noexcept;
+
+    public:
+        PipelinedWindow(int width, int height, const char *title);
+    };
+}
+
+template <std::copyable RenderState> requires std::default_initializable<RenderState>
+OpenGL::PipelinedWindow<RenderState>::PipelinedWindow(int width, int height, const char *title) : Window { width, height, title } {
+    setPipelined(true);
+}
+
+template <std::copyable RenderState> requires std::default_initializable<RenderState>
+void OpenGL::PipelinedWindow<RenderState>::update(float time_delta) {
+    updateRenderState(time_delta, render_states[1 - front_index]);
+}
+
+template <std::copyable RenderState> requires std::default_initializable<RenderState>
+void OpenGL::PipelinedWindow<RenderState>::draw(float interpolation_alpha) const {
+    drawRenderState(render_states[front_index], interpolation_alpha);
+}
+
+template <std::copyable RenderState> requires std::default_initializable<RenderState>
+void OpenGL::PipelinedWindow<RenderState>::publishRenderState() {
+    front_index = 1 - front_index;
+    render_states[1 - front_index] = render_states[front_index];
+}
+
+template <std::copyable RenderState> requires std::default_initializable<RenderState>
+RenderState &OpenGL::PipelinedWindow<RenderState>::getRenderState() noexcept {
+    return render_states[1 - front_index];
+}
@@ -4,9 +4,17 @@
 
 #pragma once
 
+#include <cstddef>
 #include <filesystem>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <type_traits>
 #include <vector>
 #include <GL/glew.h>
+#include <glm/ext/matrix_float3x3.hpp>
+#include <glm/ext/matrix_float4x4.hpp>
 #include "Shader.hpp"
 
 namespace OpenGL{
@@ -15,12 +23,45 @@ namespace OpenGL{
      * @note This class follows RAII structure, so render_program is created when the object is constructed and deleted when the object is destructed.
      */
     struct Program{
+    public:
+        /**
+         * @brief Active uniform or attribute, reflected from the program after linking.
+         */
+        struct ActiveVariable{
+            std::string name; // For arrays, name of the first element, e.g. "lights[0]".
+            GLint location; // -1 for the uniforms in uniform blocks.
+            GLenum type; // e.g. GL_FLOAT_VEC3, GL_SAMPLER_2D.
+            GLint size; // Number of array elements, 1 for non-array.
+        };
+
+        struct Statistics{
+            std::size_t program_count; // Programs alive, including the separable ones.
+            std::size_t separable_program_count; // Separable programs alive.
+            std::size_t link_count; // Total programs linked by the constructors.
+            double link_time; // Total time spent in glLinkProgram by the constructors, in seconds. Drivers which link in the background report less.
+        };
+
     private:
-        mutable std::vector<std::pair<const std::string, GLint>> uniform_locations;
+        struct UniformLookup{
+            GLint location;
+            GLenum type;
+        };
 
-    public:
-        const GLuint handle;
+        mutable std::vector<std::pair<const std::string, UniformLookup>> uniform_locations;
+        mutable std::vector<std::string> inactive_uniform_names;
+        std::vector<ActiveVariable> active_uniforms, active_attributes;
+        GLuint handle;
+        GLbitfield stages; // e.g. GL_VERTEX_SHADER_BIT | GL_FRAGMENT_SHADER_BIT.
+        bool separable;
+
+        void reflect();
+        const UniformLookup &findUniform(std::string_view name) const;
+
+        template <typename T>
+        static constexpr GLenum getUniformType() noexcept;
+        static bool isAssignable(GLenum uniform_type, GLenum value_type) noexcept;
 
+    public:
         /**
          * @brief Construct a new Program object.
          * @param vertex_shader_path Path to the vertex shader source file.
@@ -37,8 +78,47 @@ namespace OpenGL{
          */
         Program(const Shader &vertex_shader, const Shader &fragment_shader);
 
+        /**
+         * @brief Construct a separable program of the single stage of \p shader , which is combined with the programs of
+         * the other stages by \p ProgramPipeline rather than linked with them.
+         * @param shader Vertex, tessellation control, tessellation evaluation, geometry or fragment shader.
+         * @throw std::runtime_error If separate shader objects are not supported, if \p shader is a compute shader or of
+         * an unknown type, or in debug mode, if linking fails.
+         * @note A separable vertex shader must redeclare the built-in output block it writes, e.g.
+         * "out gl_PerVertex { vec4 gl_Position; };", and the interface between the stages is matched by location or by
+         * name at draw time instead of link time.
+         */
+        explicit Program(const Shader &shader);
+
+        Program(const Program&) = delete; // Program cannot be copied.
         ~Program() noexcept;
 
+        /**
+         * @brief Get the OpenGL handle of the render_program.
+         * @return Program handle.
+         * @note The handle may be changed by \p replace (e.g. shader hot-reload), so do not store it.
+         */
+        [[nodiscard]] GLuint getHandle() const noexcept;
+
+        /**
+         * @brief Get the stages which the program has.
+         * @return Stage bits for \p glUseProgramStages , e.g. \p GL_VERTEX_SHADER_BIT .
+         */
+        [[nodiscard]] GLbitfield getStages() const noexcept;
+        [[nodiscard]] bool isSeparable() const noexcept;
+
+        /**
+         * @brief Replace the underlying render_program object with \p new_handle , which must be successfully linked.
+         * @param new_handle New render_program handle. Its ownership is transferred to this object.
+         * @note Uniform values set to the previous render_program (including the pending uniforms in \p OpenGL::State ) and
+         * its uniform block bindings are copied to the new render_program by their names, and the cached uniform
+         * locations are resolved again. If the previous render_program is in use, the new one is used instead. The
+         * previous render_program is deleted.
+         * For a separable program, \p new_handle must be separable too, and the pipelines using the program must set
+         * its stages again.
+         */
+        void replace(GLuint new_handle);
+
         /**
          * @brief Get the uniform location of the uniform variable of name \p name .
          * @param name Name of the uniform variable.
@@ -50,9 +130,32 @@ namespace OpenGL{
          * @brief Set the uniform variable of \p name to \p value .
          * @param name Name of the uniform variable.
          * @param value Value to set.
+         * @throw std::runtime_error In debug mode, the type of \p value is checked against the reflected uniform type
+         * and throw if mismatched.
+         * @note If the uniform is not active (misspelled or optimized out), the call is dropped without any GL call or
+         * queueing, and its name is reported by \p getInactiveUniformNames .
          */
         void setUniform(std::string_view name, auto value) const;
 
+        /**
+         * @brief Get the active uniforms reflected at link time.
+         * @return Active uniforms.
+         */
+        [[nodiscard]] std::span<const ActiveVariable> getActiveUniforms() const noexcept;
+
+        /**
+         * @brief Get the active vertex attributes reflected at link time.
+         * @return Active attributes.
+         */
+        [[nodiscard]] std::span<const ActiveVariable> getActiveAttributes() const noexcept;
+
+        /**
+         * @brief Get the names which are requested by \p setUniform or \p getUniformLocation but not active, i.e. whose
+         * uniform calls are dropped.
+         * @return Inactive uniform names, in the requested order.
+         */
+        [[nodiscard]] std::span<const std::string> getInactiveUniformNames() const noexcept;
+
         /**
          * @brief Set the uniform block binding point of the uniform block of \p name to \p binding_point .
          * @param name Name of the uniform block.
@@ -67,13 +170,49 @@ namespace OpenGL{
 
         template <std::convertible_to<Program>... Programs>
         static void setUniformBlockBindings(const char *name, GLuint binding_point, Programs &...programs);
+
+        /**
+         * @brief Get the program counts and the link time, accumulated over every Program of the process.
+         * @return Statistics.
+         */
+        [[nodiscard]] static const Statistics &getStatistics() noexcept;
     };
 }
 
 #include "State.hpp"
 
+template <typename T>
+constexpr GLenum OpenGL::Program::getUniformType() noexcept {
+    if constexpr (std::is_same_v<T, int>) return GL_INT;
+    else if constexpr (std::is_same_v<T, unsigned int>) return GL_UNSIGNED_INT;
+    else if constexpr (std::is_same_v<T, float>) return GL_FLOAT;
+    else if constexpr (std::is_same_v<T, glm::ivec2>) return GL_INT_VEC2;
+    else if constexpr (std::is_same_v<T, glm::uvec2>) return GL_UNSIGNED_INT_VEC2;
+    else if constexpr (std::is_same_v<T, glm::vec2>) return GL_FLOAT_VEC2;
+    else if constexpr (std::is_same_v<T, glm::ivec3>) return GL_INT_VEC3;
+    else if constexpr (std::is_same_v<T, glm::uvec3>) return GL_UNSIGNED_INT_VEC3;
+    else if constexpr (std::is_same_v<T, glm::vec3>) return GL_FLOAT_VEC3;
+    else if constexpr (std::is_same_v<T, glm::ivec4>) return GL_INT_VEC4;
+    else if constexpr (std::is_same_v<T, glm::uvec4>) return GL_UNSIGNED_INT_VEC4;
+    else if constexpr (std::is_same_v<T, glm::vec4>) return GL_FLOAT_VEC4;
+    else if constexpr (std::is_same_v<T, glm::mat3>) return GL_FLOAT_MAT3;
+    else if constexpr (std::is_same_v<T, glm::mat4>) return GL_FLOAT_MAT4;
+    else static_assert(!sizeof(T), "Unsupported uniform type.");
+}
+
 void OpenGL::Program::setUniform(std::string_view name, auto value) const {
-    OpenGL::State::setUniform(handle, getUniformLocation(name), std::move(value));
+    const auto [location, type] = findUniform(name);
+    if (location == -1){
+        return;
+    }
+
+#ifndef NDEBUG
+    if (!isAssignable(type, getUniformType<decltype(value)>())){
+        throw std::runtime_error { "Uniform type mismatch: " + std::string { name } };
+    }
+#endif
+
+    OpenGL::State::setUniform(handle, location, std::move(value));
 }
 
 template <std::convertible_to<OpenGL::Program>... Programs>
@@ -0,0 +1,76 @@
+//
+// Created by gomkyung2 on 2026/10/19.
+//
+
+#pragma once
+
+/* SYNOPSIS.
+ *
+ * A monolithic Program links a vertex and a fragment shader together, so N vertex shaders combined with M fragment
+ * shaders need N×M programs and as many links. With separate shader objects (GL 4.1 or ARB_separate_shader_objects),
+ * each stage is linked once into its own separable Program, and a program pipeline combines one program per stage at
+ * bind time, without linking. Pipelines are cheap objects: keep one per combination, or change the stages of a single
+ * pipeline between draws.
+ *
+ *     OpenGL::Program vertex_program { OpenGL::Shader::fromFile(GL_VERTEX_SHADER, "mesh.vert") };
+ *     OpenGL::Program fragment_program { OpenGL::Shader::fromFile(GL_FRAGMENT_SHADER, "phong.frag") };
+ *     OpenGL::ProgramPipeline pipeline { vertex_program, fragment_program };
+ *
+ *     fragment_program.setUniform("shininess", 32.f); // Uniforms are set to the program of each stage.
+ *     pipeline.use();
+ *
+ * The pipeline binding is tracked by OpenGL::State, so using the bound pipeline again is free. ProgramVariants builds
+ * pipelines of separable stages by getPipeline().
+ */
+
+#include <cstddef>
+
+#include <GL/glew.h>
+
+#include "Program.hpp"
+
+namespace OpenGL{
+    class ProgramPipeline{
+    private:
+        GLuint handle;
+
+    public:
+        /**
+         * @brief Create a pipeline without any stage.
+         * @throw std::runtime_error If separate shader objects are not supported.
+         */
+        ProgramPipeline();
+
+        /**
+         * @brief Create a pipeline of the stages of \p vertex_program and \p fragment_program .
+         * @param vertex_program Separable program which has the vertex stage.
+         * @param fragment_program Separable program which has the fragment stage.
+         * @throw std::runtime_error If separate shader objects are not supported.
+         */
+        ProgramPipeline(const Program &vertex_program, const Program &fragment_program);
+
+        ProgramPipeline(const ProgramPipeline&) = delete; // ProgramPipeline cannot be copied.
+        ~ProgramPipeline() noexcept;
+
+        /**
+         * @brief Use every stage of \p program in the pipeline, replacing the programs previously set to the stages.
+         * @param program Separable program.
+         * @note Call it again after \p program is replaced (e.g. shader hot-reload), since the pipeline refers to the
+         * program handle.
+         */
+        void setStages(const Program &program);
+
+        /**
+         * @brief Bind the pipeline by \p OpenGL::State::setPipeline .
+         */
+        void use() const;
+
+        [[nodiscard]] GLuint getHandle() const noexcept;
+
+        /**
+         * @brief Get the number of pipelines alive in the process.
+         * @return Pipeline count.
+         */
+        [[nodiscard]] static std::size_t getCount() noexcept;
+    };
+}
@@ -0,0 +1,89 @@
+//
+// Created by gomkyung2 on 2026/10/19.
+//
+
+#pragma once
+
+#include <filesystem>
+#include <memory>
+#include <span>
+#include <string>
+#include <unordered_map>
+
+#include "Program.hpp"
+#include "ProgramPipeline.hpp"
+#include "ShaderPreprocessor.hpp"
+
+namespace OpenGL{
+    /**
+     * @brief Cache of programs keyed by (source set, define set).
+     * @note Each permutation is preprocessed, compiled and linked once at the first request. Compiled shader stages are
+     * also cached, so programs sharing a stage (same source file and defines) do not compile it again.
+     *
+     * With separate shader objects, \p getPipeline links each stage once into a separable program and combines them in
+     * a program pipeline, so N vertex and M fragment permutations need N + M links instead of N × M.
+     */
+    class ProgramVariants{
+    public:
+        struct Variant{
+            std::filesystem::path vertex_shader_path;
+            std::filesystem::path fragment_shader_path;
+            ShaderDefines defines;
+        };
+
+    private:
+        ShaderPreprocessor preprocessor;
+        std::unordered_map<std::string, std::unique_ptr<Shader>> shaders;
+        std::unordered_map<std::string, std::unique_ptr<Program>> programs;
+        std::unordered_map<std::string, std::unique_ptr<Program>> stage_programs;
+        std::unordered_map<std::string, std::unique_ptr<ProgramPipeline>> pipelines;
+
+        const Shader &getShader(GLenum type, const std::filesystem::path &path, const ShaderDefines &sorted_defines);
+
+    public:
+        explicit ProgramVariants(ShaderPreprocessor preprocessor = ShaderPreprocessor { });
+
+        /**
+         * @brief Get the program of the given permutation, compile and link it if it is not cached yet.
+         * @param vertex_shader_path Path to the vertex shader source file.
+         * @param fragment_shader_path Path to the fragment shader source file.
+         * @param defines Defines to be injected into both shaders. Their order does not matter.
+         * @return Reference to the cached program, which is valid until this object is destroyed.
+         * @throw std::runtime_error If preprocessing fails, or in debug mode, compilation or linking fails.
+         */
+        Program &get(const std::filesystem::path &vertex_shader_path, const std::filesystem::path &fragment_shader_path, const ShaderDefines &defines = {});
+        Program &get(const Variant &variant);
+
+        /**
+         * @brief Build all \p variants up front, typically at load time, so that no compilation happens during frames.
+         * @param variants Permutations to be built.
+         */
+        void warmUp(std::span<const Variant> variants);
+
+        /**
+         * @brief Get the separable program of a single stage, compile and link it if it is not cached yet.
+         * @param type Shader type, \p GL_VERTEX_SHADER or \p GL_FRAGMENT_SHADER .
+         * @param path Path to the shader source file.
+         * @param defines Defines to be injected into the shader. Their order does not matter.
+         * @return Reference to the cached program, which is valid until this object is destroyed. Set the uniforms of
+         * the stage to it.
+         * @throw std::runtime_error If separate shader objects are not supported, if preprocessing fails, or in debug
+         * mode, compilation or linking fails.
+         */
+        Program &getStageProgram(GLenum type, const std::filesystem::path &path, const ShaderDefines &defines = {});
+
+        /**
+         * @brief Get the pipeline of the given permutation, made of the separable programs by \p getStageProgram .
+         * @return Reference to the cached pipeline, which is valid until this object is destroyed.
+         * @throw std::runtime_error Same as \p getStageProgram .
+         * @see get
+         */
+        ProgramPipeline &getPipeline(const std::filesystem::path &vertex_shader_path, const std::filesystem::path &fragment_shader_path, const ShaderDefines &defines = {});
+        ProgramPipeline &getPipeline(const Variant &variant);
+
+        [[nodiscard]] std::size_t getProgramCount() const noexcept;
+        [[nodiscard]] std::size_t getStageProgramCount() const noexcept;
+        [[nodiscard]] std::size_t getPipelineCount() const noexcept;
+        [[nodiscard]] std::size_t getShaderCount() const noexcept;
+    };
+}
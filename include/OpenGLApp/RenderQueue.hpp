@@ -0,0 +1,146 @@
+//
+// Created by gomkyung2 on 2026/10/19.
+//
+
+#pragma once
+
+/* SYNOPSIS.
+ *
+ * RenderQueue collects the draw items of a frame and submits them ordered by a 64-bit sort key, so that render target,
+ * program, material (texture set) and vertex array switches are minimized. The key is composed of, from the most
+ * significant bit:
+ *
+ *   render target (4) | pass (4) | program (12) | material (16) | vertex array (12) | depth (16)
+ *
+ * Render targets, programs and vertex arrays are mapped to dense indices in the order they are first seen in each
+ * submit(), so a frame may use at most 16 render targets and 4096 programs and vertex arrays while sorting. Depth is
+ * quantized in the range given by setDepthRange(), and sorted front to back. For passes set to DepthOrder::BackToFront
+ * (e.g. translucent objects), depth is inverted and placed right after the pass, since the drawing order matters more
+ * than the state changes there.
+ *
+ * Keys are sorted by LSD radix sort, skipping the bytes which are the same for every key. submit() binds only the
+ * changed states: programs through OpenGL::State, materials to texture units 0, 1, ... in their order. The switch counts
+ * of the sorted order and of the push order are both reported by getStatistics(), to measure the benefit of sorting.
+ */
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <unordered_map>
+#include <vector>
+
+#include <GL/glew.h>
+
+namespace OpenGL{
+    class RenderQueue{
+    public:
+        using MaterialId = std::uint16_t;
+        static constexpr MaterialId no_material = std::numeric_limits<MaterialId>::max();
+        static constexpr std::size_t max_pass_count = 16;
+
+        enum class DepthOrder { FrontToBack, BackToFront };
+
+        struct TextureBinding{
+            GLenum target;
+            GLuint texture;
+        };
+
+        struct DrawItem{
+            GLuint framebuffer = 0;
+            std::uint8_t pass = 0; // Less than max_pass_count.
+            GLuint program;
+            MaterialId material = no_material;
+            GLuint vertex_array;
+            float depth = 0.f; // View space distance.
+
+            GLenum mode = GL_TRIANGLES;
+            GLsizei count;
+            GLenum index_type = GL_NONE; // GL_NONE for glDrawArrays, otherwise glDrawElements with this index type.
+            std::uintptr_t first = 0; // First vertex for glDrawArrays, byte offset of the first index for glDrawElements.
+            GLsizei instance_count = 1;
+
+            // Called after the states are bound, e.g. for setting the per-object uniforms.
+            void (*set_uniforms)(const void *user_data) = nullptr;
+            const void *user_data = nullptr;
+        };
+
+        struct SwitchCounts{
+            std::size_t framebuffer = 0;
+            std::size_t program = 0;
+            std::size_t material = 0;
+            std::size_t vertex_array = 0;
+        };
+
+        struct Statistics{
+            std::size_t draw_count = 0;
+            SwitchCounts unsorted; // If submitted in the push order.
+            SwitchCounts sorted; // Actually submitted.
+        };
+
+    private:
+        struct SortEntry{
+            std::uint64_t key;
+            std::uint32_t index;
+        };
+
+        std::vector<DrawItem> items;
+        std::vector<SortEntry> sort_entries, sort_scratch;
+        std::vector<std::vector<TextureBinding>> materials;
+        std::unordered_map<GLuint, std::uint64_t> framebuffer_indices, program_indices, vertex_array_indices;
+        std::array<DepthOrder, max_pass_count> depth_orders {};
+        std::array<std::function<void()>, max_pass_count> pass_callbacks;
+        float depth_near = 0.f, depth_far = 1.f;
+        bool sorting = true;
+        Statistics statistics;
+
+        std::uint64_t makeKey(const DrawItem &item);
+        void bindMaterial(MaterialId material) const;
+
+        template <typename Indices>
+        SwitchCounts countSwitches(Indices &&indices) const;
+
+    public:
+        /**
+         * @brief Register a texture set.
+         * @param textures Textures, bound to the texture units 0, 1, ... in order.
+         * @return Material id to be used in \p DrawItem::material .
+         */
+        MaterialId addMaterial(std::vector<TextureBinding> textures);
+
+        /**
+         * @brief Set the range of \p DrawItem::depth used for the quantization. Depths outside the range are clamped.
+         * @throw std::runtime_error If \p near and \p far are equal.
+         */
+        void setDepthRange(float near, float far);
+
+        void setDepthOrder(std::uint8_t pass, DepthOrder order) noexcept;
+
+        /**
+         * @brief Set the function called when \p pass begins in submission, e.g. for changing the blending state.
+         * @param pass Pass index.
+         * @param callback Function to be called.
+         */
+        void setPassCallback(std::uint8_t pass, std::function<void()> callback);
+
+        /**
+         * @brief Enable or disable sorting. If disabled, items are submitted in the push order (the redundant binds are
+         * still skipped). Enabled by default.
+         */
+        void setSorting(bool enabled) noexcept;
+
+        void push(const DrawItem &item);
+
+        /**
+         * @brief Sort and submit the pushed items, then clear them. Must be called in the GL thread.
+         */
+        void submit();
+
+        /**
+         * @brief Get the statistics of the last \p submit .
+         * @return Submission statistics.
+         */
+        [[nodiscard]] const Statistics &getStatistics() const noexcept;
+    };
+}
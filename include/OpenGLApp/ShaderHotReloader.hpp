@@ -0,0 +1,126 @@
+//
+// Created by gomkyung2 on 2026/10/19.
+//
+
+#pragma once
+
+/* SYNOPSIS.
+ *
+ * ShaderHotReloader watches the shader source files of the registered programs, and rebuilds a program when its source
+ * files are changed. The sources are read through ShaderPreprocessor with the defines the program was built with, and
+ * the files they include are watched as well. The work is split into three steps so that the frame is never blocked by
+ * the reload:
+ *
+ * 1. A watcher thread waits for file changes (inotify on Linux, periodic modification time check elsewhere) and
+ * preprocesses the changed sources.
+ * 2. poll(), which should be called once per frame in the GL thread, issues the compilation of the new sources. If
+ * KHR_parallel_shader_compile (or ARB_parallel_shader_compile) is available, the compilation and linking run in the
+ * driver threads, and poll() only checks their completion status in the subsequent frames. Otherwise, they are done
+ * synchronously in poll().
+ * 3. When linking is succeeded, the program is swapped in place by Program::replace(), which migrates the uniform values
+ * and locations. If compilation or linking is failed, the old program is kept and the error callback is called.
+ */
+
+#include <filesystem>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+#include "Program.hpp"
+#include "ShaderPreprocessor.hpp"
+
+namespace OpenGL{
+    class ShaderHotReloader{
+    public:
+        using ErrorCallback = std::function<void(const std::filesystem::path &vertex_shader_path, const std::filesystem::path &fragment_shader_path, std::string_view info_log)>;
+
+    private:
+        struct WatchedProgram{
+            Program *program;
+            std::filesystem::path vertex_shader_path, fragment_shader_path;
+            ShaderDefines defines;
+            std::vector<std::filesystem::path> source_files; // Both shader files and all the files they include.
+            std::filesystem::file_time_type last_write_time; // Used only by the polling watcher.
+        };
+
+        struct ChangedSources{
+            Program *program;
+            std::filesystem::path vertex_shader_path, fragment_shader_path;
+            std::string vertex_shader_source, fragment_shader_source;
+        };
+
+        struct PreprocessError{
+            std::filesystem::path vertex_shader_path, fragment_shader_path;
+            std::string message;
+        };
+
+        struct Build{
+            enum class Stage { Compiling, Linking };
+
+            Program *program;
+            std::filesystem::path vertex_shader_path, fragment_shader_path; // For error reporting.
+            GLuint vertex_shader, fragment_shader, program_handle;
+            Stage stage;
+        };
+
+        std::vector<WatchedProgram> watched_programs; // Guarded by mutex.
+        std::vector<ChangedSources> changed_sources; // Guarded by mutex.
+        std::vector<PreprocessError> preprocess_errors; // Guarded by mutex.
+        std::mutex mutex;
+
+        ShaderPreprocessor preprocessor;
+
+        std::vector<Build> builds; // Accessed only in the GL thread.
+        bool parallel_compile;
+        ErrorCallback error_callback;
+
+#ifdef __linux__
+        int inotify_fd, wakeup_fd;
+        std::vector<std::pair<int, std::filesystem::path>> watch_descriptors; // Guarded by mutex.
+#endif
+        std::jthread watcher_thread; // Must be declared last, since the thread uses the members above.
+
+        void watcherMain(std::stop_token stop_token);
+        void watchSourceFiles(WatchedProgram &watched, std::vector<std::filesystem::path> source_files);
+        void onFileChanged(const std::filesystem::path &path);
+        void startBuild(ChangedSources &&sources);
+        bool isCompleted(GLuint handle, bool is_program) const;
+        void discardBuild(const Build &build) const;
+
+    public:
+        /**
+         * @brief Start watching. Must be constructed in the GL thread, after the context is created.
+         * @param preprocessor Preprocessor to read the sources with. It should be the one the programs are built with.
+         * @param error_callback Called in poll() with the info log if a changed source fails to preprocess, compile or
+         * link. If not given, the log is printed into \p std::cerr .
+         */
+        explicit ShaderHotReloader(ShaderPreprocessor preprocessor = ShaderPreprocessor { }, ErrorCallback error_callback = {});
+        ShaderHotReloader(const ShaderHotReloader&) = delete;
+        ~ShaderHotReloader() noexcept;
+
+        /**
+         * @brief Rebuild \p program when one of the given source files, or a file included by them, is changed.
+         * @param program Program to be rebuilt. It must outlive this object or be unwatched before destroyed.
+         * @param vertex_shader_path Path to the vertex shader source file.
+         * @param fragment_shader_path Path to the fragment shader source file.
+         * @param defines Defines \p program is built with, which are injected into the reloaded sources too.
+         * @throw std::runtime_error If the sources cannot be preprocessed, or their directories cannot be watched.
+         */
+        void watch(Program &program, const std::filesystem::path &vertex_shader_path, const std::filesystem::path &fragment_shader_path, const ShaderDefines &defines = {});
+
+        /**
+         * @brief Stop watching \p program . Pending rebuilds of it are discarded.
+         * @param program Program to stop watching.
+         */
+        void unwatch(const Program &program);
+
+        /**
+         * @brief Issue the compilation of the changed sources and swap the programs whose linking is completed.
+         * @note Must be called in the GL thread, typically once per frame before drawing.
+         */
+        void poll();
+    };
+}
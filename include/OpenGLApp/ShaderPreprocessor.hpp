@@ -0,0 +1,54 @@
+//
+// Created by gomkyung2 on 2026/10/19.
+//
+
+#pragma once
+
+/* SYNOPSIS.
+ *
+ * GLSL has no #include, and the only way to parameterize a shader is to edit its source. ShaderPreprocessor resolves
+ * the following before the source is passed to the driver:
+ *
+ * 1. #include "path" (or <path>): the path is searched in the directory of the including file, then in the include
+ * directories, in order. Each file is included at most once per shader (like #pragma once), and cyclic inclusion is an
+ * error. #line directives are emitted so that the line numbers in compile errors refer to the original files; the
+ * source string number is the index of the file in the order they are included (0 is the main file).
+ * 2. Injected defines: "#define NAME VALUE" lines are inserted right after the #version directive. Since nothing but
+ * comments may precede #version, the main file must have one if any define is given.
+ */
+
+#include <filesystem>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace OpenGL{
+    /**
+     * @brief List of (name, value) pairs to be defined in the shader. Value can be empty.
+     */
+    using ShaderDefines = std::vector<std::pair<std::string, std::string>>;
+
+    class ShaderPreprocessor{
+    private:
+        std::vector<std::filesystem::path> include_directories;
+
+    public:
+        /**
+         * @brief Construct a new ShaderPreprocessor object.
+         * @param include_directories Directories to search the included files, after the directory of the including file.
+         */
+        explicit ShaderPreprocessor(std::vector<std::filesystem::path> include_directories = {});
+
+        /**
+         * @brief Read the shader source file and resolve its includes and defines.
+         * @param filename Path to the shader source file.
+         * @param defines Defines to be injected.
+         * @param included_files If given, filled with the paths of \p filename and all the files it includes, in the order
+         * of their source string numbers.
+         * @return Preprocessed source.
+         * @throw std::runtime_error If the file or an included file cannot be opened, includes are cyclic, or \p defines
+         * is not empty but the file has no #version directive.
+         */
+        [[nodiscard]] std::string preprocess(const std::filesystem::path &filename, const ShaderDefines &defines = {}, std::vector<std::filesystem::path> *included_files = nullptr) const;
+    };
+}
@@ -23,6 +23,15 @@
  * is managed in a queue.
  * The lifetime of the value argument should persist until the render_program used, so it is captured by the uniform-setting
  * function (which means the value copied).
+ *
+ * The queue exists only because glUniform* writes to the program in use. If glProgramUniform* is supported (GL 4.1 or
+ * ARB_separate_shader_objects, see Capabilities.hpp), setUniform() writes to the given program immediately without
+ * queueing, and nothing is left pending for setProgram() or flushPendingUniforms(). The queue is the fallback for older
+ * contexts.
+ *
+ * 3. Program pipelines (see ProgramPipeline.hpp) are tracked in the same way: setPipeline() skips binding the pipeline
+ * which is already bound. Since a program used by glUseProgram takes precedence over the bound pipeline, setPipeline()
+ * also makes no program in use.
  */
 
 #include <optional>
@@ -34,6 +43,35 @@ namespace OpenGL::State{
     std::optional<GLuint> getProgram();
     bool setProgram(GLuint program);
 
+    /**
+     * @brief Apply all pending uniforms of \p program immediately.
+     * @param program Program whose pending uniforms are applied.
+     * @note The program is used if there are pending uniforms, and the previously used program is restored after that.
+     */
+    void flushPendingUniforms(GLuint program);
+
+    /**
+     * @brief Notify that \p old_program is replaced by \p new_program . If \p old_program is in use, \p new_program is used.
+     * @param old_program Replaced program, which must not have pending uniforms (see flushPendingUniforms()).
+     * @param new_program New program.
+     */
+    void replaceProgram(GLuint old_program, GLuint new_program);
+
+    std::optional<GLuint> getPipeline();
+
+    /**
+     * @brief Bind \p pipeline if it is not bound yet, and stop using the current program so that the pipeline is in effect.
+     * @param pipeline Program pipeline handle.
+     * @return \p true if glBindProgramPipeline is called.
+     */
+    bool setPipeline(GLuint pipeline);
+
+    /**
+     * @brief Delete \p pipeline , and forget its binding if it is bound.
+     * @param pipeline Program pipeline handle.
+     */
+    void deletePipeline(GLuint pipeline);
+
     void setUniform(GLuint program, GLint uniform_location, int value);
     void setUniform(GLuint program, GLint uniform_location, unsigned int value);
     void setUniform(GLuint program, GLint uniform_location, float value);
@@ -0,0 +1,74 @@
+//
+// Created by gomkyung2 on 2026/10/19.
+//
+
+#pragma once
+
+/* SYNOPSIS.
+ *
+ * TextureArrayBuilder groups images of the same size and GL format (Utils::Image::getGLFormat) into GL_TEXTURE_2D_ARRAY textures, one layer per
+ * image. Materials whose textures are in the same array can be drawn without rebinding: pass the layer index (e.g. as a
+ * uniform or a vertex attribute) and sample with texture(sampler2DArray, vec3(uv, layer)). Unlike atlases, each layer
+ * has its own mip chain and wrap mode, so repeated texture coordinates work as usual.
+ *
+ * If ARB_bindless_texture is supported, each array also gets a resident bindless handle, which can be stored in a
+ * uniform buffer so that even the arrays need not be bound.
+ */
+
+#include <cstddef>
+#include <span>
+#include <vector>
+
+#include <GL/glew.h>
+
+#include "Utils/Image.hpp"
+
+namespace OpenGL{
+    class TextureArrayBuilder{
+    public:
+        struct Layer{
+            GLuint texture; // GL_TEXTURE_2D_ARRAY handle.
+            GLint layer;
+            GLuint64 bindless_handle; // 0 if ARB_bindless_texture is not supported.
+        };
+
+    private:
+        struct Group{
+            int width, height;
+            Utils::Image::GLFormat format;
+            std::vector<std::size_t> image_indices;
+        };
+
+        std::vector<const Utils::Image*> images;
+        std::vector<Layer> layers;
+        std::vector<GLuint> textures;
+        std::vector<GLuint64> bindless_handles;
+
+    public:
+        TextureArrayBuilder() = default;
+        TextureArrayBuilder(const TextureArrayBuilder&) = delete;
+        ~TextureArrayBuilder() noexcept;
+
+        /**
+         * @brief Add an image to be built into a texture array.
+         * @param image Image with 1 to 4 channels. It must be alive until \p build .
+         * @return Index of the image, used by \p getLayer .
+         */
+        std::size_t add(const Utils::Image &image);
+
+        /**
+         * @brief Create a texture array for each group of the same size and format, with mipmaps. Must be called
+         * in the GL thread.
+         * @note The created textures are owned by this object.
+         */
+        void build();
+
+        [[nodiscard]] const Layer &getLayer(std::size_t image_index) const noexcept;
+
+        /**
+         * @brief Get the created texture arrays.
+         * @return Texture array handles.
+         */
+        [[nodiscard]] std::span<const GLuint> getTextures() const noexcept;
+    };
+}
@@ -0,0 +1,85 @@
+//
+// Created by gomkyung2 on 2026/10/19.
+//
+
+#pragma once
+
+/* SYNOPSIS.
+ *
+ * TextureAtlas packs small images into a single GL_TEXTURE_2D, so that objects with different textures can be drawn
+ * without rebinding. Images are packed by Utils::SkylinePacker and composed into an RGBA8 image in CPU memory, then
+ * uploaded once with the mip chain built by MipChain by build().
+ *
+ * Texture coordinates of each image are remapped by its Region: uv_atlas = offset + uv * scale. For repeated texture
+ * coordinates (outside [0, 1]), wrap them in the shader and pass the unwrapped derivatives, so that the mip level is not
+ * broken at the wrap seams:
+ *
+ *     textureGrad(atlas, region.offset + fract(uv) * region.scale, dFdx(uv) * region.scale, dFdy(uv) * region.scale)
+ *
+ * Each image is surrounded by \p padding texels which repeat its edge, to prevent the neighbors from bleeding in by
+ * linear filtering and the coarser mip levels.
+ */
+
+#include <cstddef>
+#include <optional>
+#include <vector>
+
+#include <GL/glew.h>
+#include <glm/vec2.hpp>
+
+#include "Utils/Image.hpp"
+#include "Utils/SkylinePacker.hpp"
+
+namespace OpenGL{
+    class TextureAtlas{
+    public:
+        struct Region{
+            glm::vec2 offset;
+            glm::vec2 scale;
+        };
+
+    private:
+        int width, height, padding;
+        Utils::SkylinePacker packer;
+        std::vector<unsigned char> pixels; // RGBA8, cleared after build().
+        std::vector<Region> regions;
+        GLuint handle = 0;
+        GLuint64 bindless_handle = 0;
+
+    public:
+        /**
+         * @brief Construct an empty atlas.
+         * @param width Width of the atlas texture.
+         * @param height Height of the atlas texture.
+         * @param padding Number of texels around each image, which repeat the image's edge.
+         */
+        TextureAtlas(int width, int height, int padding = 4);
+        TextureAtlas(const TextureAtlas&) = delete;
+        ~TextureAtlas() noexcept;
+
+        /**
+         * @brief Pack \p image into the atlas. Must be called before \p build .
+         * @param image Image with 1 to 4 channels. Gray and gray-alpha images are expanded to RGB.
+         * @return Index of the region, \p std::nullopt if there is no space left.
+         */
+        std::optional<std::size_t> add(const Utils::Image &image);
+
+        /**
+         * @brief Upload the atlas texture with mipmaps and free the CPU copy. Must be called in the GL thread.
+         * @return Texture handle, owned by this object.
+         * @note If ARB_bindless_texture is supported, a resident bindless handle is also created.
+         */
+        GLuint build();
+
+        [[nodiscard]] const Region &getRegion(std::size_t index) const noexcept;
+        [[nodiscard]] GLuint getHandle() const noexcept;
+
+        /**
+         * @brief Get the resident bindless texture handle.
+         * @return Bindless handle, 0 if ARB_bindless_texture is not supported or not built.
+         */
+        [[nodiscard]] GLuint64 getBindlessHandle() const noexcept;
+
+        [[nodiscard]] float getOccupancy() const noexcept;
+    };
+}
@@ -0,0 +1,116 @@
+//
+// Created by gomkyung2 on 2026/10/19.
+//
+
+#pragma once
+
+/* SYNOPSIS.
+ *
+ * TextureStreamer keeps only the mip levels which are needed for the current view in GPU memory. Each texture starts
+ * with its coarsest levels (up to \p initial_size texels), and every frame:
+ *
+ * 1. The application calls request() for each visible texture, with its on-screen size in pixels or its bounding
+ *    sphere and the camera. The finest level which is useful at that size is requested.
+ * 2. update() uploads one finer level at a time for the textures which need more detail, the largest deficit first,
+ *    within the per-frame upload limit. To stay under the memory budget, it frees the finest levels of the least
+ *    recently requested textures first, then the surplus levels of the textures requested in this frame.
+ *
+ * Residency is expressed by GL_TEXTURE_BASE_LEVEL (the finest resident level) over a mutable texture, so it works on
+ * GL 3.3 without sparse textures. Freed levels are respecified with zero size, which releases their storage.
+ */
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include <GL/glew.h>
+#include <glm/vec3.hpp>
+
+#include "Camera.hpp"
+#include "MipChain.hpp"
+
+namespace OpenGL{
+    class TextureStreamer{
+    public:
+        struct Statistics{
+            std::size_t resident_bytes;
+            std::size_t budget_bytes;
+            std::size_t uploaded_levels; // in the last update().
+            std::size_t evicted_levels; // in the last update().
+            std::size_t starved_textures; // Textures which could not get the requested level in the last update().
+        };
+
+    private:
+        struct Entry{
+            MipChain mip_chain;
+            GLuint handle;
+            std::uint32_t resident_level; // Finest resident level, i.e. GL_TEXTURE_BASE_LEVEL.
+            std::uint32_t floor_level; // Coarsest level which is never evicted.
+            std::uint32_t requested_level; // Finest level requested in the current frame.
+            std::uint64_t last_request_frame;
+        };
+
+        std::vector<Entry> entries;
+        std::size_t budget_bytes;
+        std::size_t upload_bytes_per_frame;
+        int initial_size;
+        std::size_t resident_bytes = 0;
+        std::uint64_t frame = 1; // 0 means never requested.
+        Statistics statistics {};
+
+        [[nodiscard]] static std::size_t getLevelBytes(const Entry &entry, std::uint32_t level) noexcept;
+
+        void uploadLevel(Entry &entry, std::uint32_t level);
+        void evictLevel(Entry &entry);
+        bool evictForRequest(std::size_t bytes, const Entry *requester);
+
+    public:
+        /**
+         * @brief Construct an empty streamer.
+         * @param budget_bytes GPU memory budget for the streamed levels in bytes. The coarsest levels, up to \p initial_size ,
+         * are always resident even if they exceed the budget.
+         * @param initial_size Maximum width and height of the levels uploaded by \p add .
+         * @param upload_bytes_per_frame Maximum bytes uploaded in an \p update , to bound the frame time spike.
+         */
+        explicit TextureStreamer(std::size_t budget_bytes, int initial_size = 64, std::size_t upload_bytes_per_frame = 8 * 1024 * 1024);
+        TextureStreamer(const TextureStreamer&) = delete;
+        ~TextureStreamer() noexcept;
+
+        /**
+         * @brief Add a texture with its CPU mip chain, and upload its coarsest levels. Must be called in the GL thread.
+         * @param mip_chain Mip chain of the texture, which is kept to upload finer levels later.
+         * @return Index of the texture.
+         * @note The texture is bound to GL_TEXTURE_2D of the active texture unit.
+         */
+        std::size_t add(MipChain mip_chain);
+
+        [[nodiscard]] GLuint getHandle(std::size_t texture) const noexcept;
+
+        /**
+         * @brief Request the level of \p texture which matches \p screen_size for the current frame.
+         * @param texture Index of the texture.
+         * @param screen_size Size of the whole texture (i.e. [0, 1] texture coordinates) on the screen in pixels.
+         */
+        void request(std::size_t texture, float screen_size) noexcept;
+
+        /**
+         * @brief Request the level of \p texture which matches the on-screen size of an object using it.
+         * @param texture Index of the texture.
+         * @param camera Camera which renders the object.
+         * @param framebuffer_height Height of the framebuffer in pixels.
+         * @param center Center of the object's bounding sphere in world space.
+         * @param radius Radius of the object's bounding sphere, over which the texture is assumed to be mapped once.
+         */
+        void request(std::size_t texture, const PerspectiveCamera &camera, int framebuffer_height, const glm::vec3 &center, float radius) noexcept;
+
+        /**
+         * @brief Upload or evict levels by the requests in this frame, then start the next frame. Call it once per frame
+         * in the GL thread, after the requests.
+         * @note Textures are bound to GL_TEXTURE_2D of the active texture unit.
+         */
+        void update();
+
+        void setBudget(std::size_t budget_bytes) noexcept;
+        [[nodiscard]] const Statistics &getStatistics() const noexcept;
+    };
+}
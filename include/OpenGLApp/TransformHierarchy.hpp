@@ -0,0 +1,149 @@
+//
+// Created by gomkyung2 on 2026/10/19.
+//
+
+#pragma once
+
+/* SYNOPSIS.
+ *
+ * TransformHierarchy stores the local transforms (translation, rotation, scale) of parented nodes in structure of
+ * arrays, sorted by depth so that every parent precedes its children. update() computes the world matrices level by
+ * level: the nodes of a level only read the world matrices of the previous level, so each level is split into chunks
+ * which run in parallel.
+ *
+ * Only the nodes whose local transform changed since the last update, and their descendants, are recomputed. The world
+ * matrices are stored contiguously in the dense (depth sorted) order, so they can be uploaded into an instance or
+ * uniform buffer as is, e.g. only the range returned by getChangedRange().
+ *
+ *     TransformHierarchy hierarchy;
+ *     const auto body = hierarchy.add();
+ *     const auto arm = hierarchy.add({ .translation = { 1.f, 0.f, 0.f } }, body);
+ *     hierarchy.setRotation(body, glm::angleAxis(angle, glm::vec3 { 0.f, 1.f, 0.f }));
+ *     hierarchy.update();
+ *     const auto [begin, end] = hierarchy.getChangedRange();
+ *     glBufferSubData(GL_ARRAY_BUFFER, begin * sizeof(glm::mat4), (end - begin) * sizeof(glm::mat4), hierarchy.getWorldMatrices().data() + begin);
+ *     // Instance hierarchy.getIndex(arm) uses the world matrix of arm.
+ *
+ * Node handles are stable, but the dense indices change when a node is added under a shallower level than the last
+ * node or removed. The whole range is reported as changed in that case.
+ */
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <span>
+#include <utility>
+#include <vector>
+
+#include <glm/ext/matrix_float4x4.hpp>
+#include <glm/ext/quaternion_float.hpp>
+#include <glm/ext/vector_float3.hpp>
+
+#include "Utils/ThreadPool.hpp"
+
+namespace OpenGL{
+    class TransformHierarchy{
+    public:
+        using Node = std::uint32_t;
+        static constexpr Node no_parent = std::numeric_limits<Node>::max();
+
+        struct Transform{
+            glm::vec3 translation { 0.f };
+            glm::quat rotation { 1.f, 0.f, 0.f, 0.f };
+            glm::vec3 scale { 1.f };
+        };
+
+    private:
+        static constexpr std::uint32_t invalid_index = std::numeric_limits<std::uint32_t>::max();
+
+        // Bits of dirty_flags.
+        static constexpr std::uint8_t local_dirty = 1; // Local transform is changed since the last update.
+        static constexpr std::uint8_t world_changed = 2; // World matrix is recomputed in the last update.
+
+        // Dense arrays, sorted by depth.
+        std::vector<Node> nodes;
+        std::vector<std::uint32_t> parents; // Dense index of the parent, or invalid_index for roots.
+        std::vector<std::uint32_t> depths;
+        std::vector<glm::vec3> translations;
+        std::vector<glm::quat> rotations;
+        std::vector<glm::vec3> scales;
+        std::vector<std::uint8_t> dirty_flags;
+        std::vector<glm::mat4> world_matrices;
+
+        std::vector<std::size_t> level_offsets { 0 }; // Level i is [level_offsets[i], level_offsets[i + 1]).
+        bool sorted = true;
+        bool structure_changed = false; // Dense indices are changed since the last update.
+        std::pair<std::size_t, std::size_t> changed_range { 0, 0 };
+
+        std::vector<std::uint32_t> node_indices; // Node to dense index, or invalid_index for free nodes.
+        std::vector<Node> free_nodes;
+
+        [[nodiscard]] std::uint32_t indexOf(Node node) const noexcept;
+
+        // Move the nodes so that order[i] becomes the i-th, dropping the nodes not in order.
+        void reorder(std::span<const std::uint32_t> order);
+        void sortByDepth();
+        void rebuildLevels();
+
+    public:
+        /**
+         * @brief Add a node with the identity local transform.
+         * @param parent Parent node, or \p no_parent for a root.
+         * @return Handle of the node.
+         */
+        Node add(Node parent = no_parent);
+
+        /**
+         * @brief Add a node.
+         * @param local Local transform, relative to the parent.
+         * @param parent Parent node, or \p no_parent for a root.
+         * @return Handle of the node.
+         * @note Adding a node under a shallower level than the last added one reorders the nodes in the next update.
+         */
+        Node add(const Transform &local, Node parent = no_parent);
+
+        /**
+         * @brief Remove \p node and all of its descendants.
+         * @param node Node to be removed. Its handle, and those of the descendants, may be reused by \p add .
+         * @note It is O(n) in the number of nodes, so remove the subtree roots rather than every node.
+         */
+        void remove(Node node);
+
+        void setTranslation(Node node, const glm::vec3 &translation) noexcept;
+        void setRotation(Node node, const glm::quat &rotation) noexcept;
+        void setScale(Node node, const glm::vec3 &scale) noexcept;
+        void setLocal(Node node, const Transform &local) noexcept;
+
+        [[nodiscard]] Transform getLocal(Node node) const noexcept;
+        [[nodiscard]] Node getParent(Node node) const noexcept;
+
+        /**
+         * @brief Recompute the world matrices of the changed nodes and their descendants.
+         * @param thread_pool Thread pool to run large levels in parallel.
+         */
+        void update(Utils::ThreadPool &thread_pool = Utils::ThreadPool::getDefault());
+
+        /**
+         * @brief Get the world matrices computed by the last \p update , in the dense order.
+         * @return World matrices, whose index of a node is \p getIndex(node) .
+         */
+        [[nodiscard]] std::span<const glm::mat4> getWorldMatrices() const noexcept;
+
+        [[nodiscard]] const glm::mat4 &getWorldMatrix(Node node) const noexcept;
+
+        /**
+         * @brief Get the dense index of \p node , which is changed only by \p remove or by the reordering in \p update .
+         * @param node Node.
+         * @return Index of the world matrix of \p node .
+         */
+        [[nodiscard]] std::size_t getIndex(Node node) const noexcept;
+
+        /**
+         * @brief Get the range of the world matrices recomputed by the last \p update .
+         * @return [begin, end) of the dense indices, which is empty if nothing is changed. It may include unchanged ones.
+         */
+        [[nodiscard]] std::pair<std::size_t, std::size_t> getChangedRange() const noexcept;
+
+        [[nodiscard]] std::size_t size() const noexcept;
+    };
+}
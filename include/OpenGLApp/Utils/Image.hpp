@@ -4,21 +4,128 @@
 
 #pragma once
 
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+#include <GL/glew.h>
+
+#include "ImageAllocator.hpp"
+#include "ThreadPool.hpp"
+
 namespace OpenGL::Utils{
     class Image{
+    public:
+        enum class PixelLayout : std::uint8_t{
+            Original, // Channels of the file, i.e. 1 (gray), 2 (gray-alpha), 3 (RGB) or 4 (RGBA).
+            R,
+            Rg,
+            Rgb,
+            Rgba,
+            Bgra, // Native layout of most GPUs, uploaded without swizzling.
+        };
+
+        enum class ColorSpace : std::uint8_t{
+            Srgb, // Color channels are sRGB-encoded, e.g. albedo textures.
+            Linear, // e.g. normal maps, roughness and other non-color data.
+        };
+
+        // Value-initialized options, i.e. {}, keep the file's channels and tag the image as sRGB.
+        struct LoadOptions{
+            PixelLayout layout;
+            ColorSpace color_space;
+        };
+
+        // Size and channels of an image file, read from its header.
+        struct Info{
+            int width;
+            int height;
+            int channels;
+        };
+
+        // Arguments of glTexImage2D for the image data.
+        struct GLFormat{
+            GLenum internal_format;
+            GLenum format;
+            GLenum type;
+        };
+
     private:
-        Image(int width, int height, int channels, const unsigned char *data) noexcept;
+        int width;
+        int height;
+        int channels;
+        unsigned char *data;
+        PixelLayout layout; // Never PixelLayout::Original.
+        ColorSpace color_space;
+        ImageAllocator *allocator; // nullptr if allocated by malloc.
+
+        Image(int width, int height, int channels, unsigned char *data, PixelLayout layout, ColorSpace color_space, ImageAllocator *allocator) noexcept;
 
-        static Image from(const char *filename);
+        static Image from(std::span<const std::byte> encoded, LoadOptions options, ImageAllocator *allocator);
 
     public:
-        const int width;
-        const int height;
-        const int channels;
-        const unsigned char *data;
+        /**
+         * @brief Decode an image file, which is read through a memory mapping.
+         * @param filename Image file name.
+         * @param options Pixel layout and color space.
+         * @param allocator Allocator of the pixels and the decoder's temporary buffers. If \p nullptr , malloc is used.
+         * It must outlive the image.
+         * @throw std::runtime_error If the file could not be read or decoded.
+         */
+        Image(const char *filename, LoadOptions options = {}, ImageAllocator *allocator = nullptr);
+
+        /**
+         * @brief Decode an image from memory, e.g. embedded in an executable or a glTF buffer.
+         * @param encoded Encoded bytes of the image file.
+         * @param options Pixel layout and color space.
+         * @param allocator Allocator of the pixels and the decoder's temporary buffers. If \p nullptr , malloc is used.
+         * It must outlive the image.
+         * @throw std::runtime_error If the image could not be decoded.
+         */
+        explicit Image(std::span<const std::byte> encoded, LoadOptions options = {}, ImageAllocator *allocator = nullptr);
 
-        Image(const char *filename);
         Image(Image &&source) noexcept;
+        Image &operator=(Image &&source) noexcept;
         ~Image() noexcept;
+
+        /**
+         * @brief Decode image files in parallel, sharing \p allocator so that its buffers are reused across the images.
+         * @param filenames Image file names.
+         * @param options Pixel layout and color space, applied to every image.
+         * @param allocator Thread-safe allocator, e.g. PoolImageAllocator. It must outlive the images.
+         * @param thread_pool Thread pool to be used for decoding.
+         * @return Decoded images, in the order of \p filenames .
+         * @throw std::runtime_error If any image could not be read or decoded.
+         */
+        static std::vector<Image> load(std::span<const char* const> filenames, LoadOptions options, ImageAllocator &allocator, ThreadPool &thread_pool = ThreadPool::getDefault());
+
+        /**
+         * @brief Read the size and the channels of an image file without decoding its pixels.
+         * @param filename Image file name.
+         * @return Size and channels of the file, i.e. of the image loaded with \p PixelLayout::Original .
+         * @throw std::runtime_error If the file could not be read or is not a supported image.
+         */
+        [[nodiscard]] static Info readInfo(const char *filename);
+
+        [[nodiscard]] int getWidth() const noexcept;
+        [[nodiscard]] int getHeight() const noexcept;
+        [[nodiscard]] int getChannels() const noexcept;
+        [[nodiscard]] const unsigned char *getData() const noexcept;
+        [[nodiscard]] PixelLayout getLayout() const noexcept;
+        [[nodiscard]] ColorSpace getColorSpace() const noexcept;
+
+        /**
+         * @brief Get the format to upload the image without driver-side conversion.
+         * @return Internal format, format and type. Internal format is sRGB for sRGB tagged RGB and RGBA/BGRA images.
+         */
+        [[nodiscard]] GLFormat getGLFormat() const noexcept;
+
+        /**
+         * @brief Get the largest \p GL_UNPACK_ALIGNMENT value which is valid for the tightly packed rows of the image.
+         * @return 8, 4, 2 or 1. RGBA and BGRA images are always 4-byte aligned or more.
+         * @note Set it by glPixelStorei before uploading, since the default (4) is wrong for e.g. odd width RGB images.
+         */
+        [[nodiscard]] GLint getRowAlignment() const noexcept;
     };
-}
\ No newline at end of file
+}
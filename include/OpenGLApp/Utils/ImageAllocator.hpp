@@ -0,0 +1,108 @@
+//
+// Created by gomkyung2 on 2026/10/19.
+//
+
+#pragma once
+
+/* SYNOPSIS.
+ *
+ * ImageAllocator provides the memory of decoded images and of the decoder's temporary buffers, instead of malloc and
+ * free. Pass it to the Utils::Image constructors; the image returns its pixels to the same allocator when destroyed, so
+ * the allocator must outlive the images it made.
+ *
+ * - PoolImageAllocator keeps freed blocks by power-of-two size classes and hands them out again, so that loading many
+ *   images of similar sizes stops calling malloc after the first few.
+ * - ArenaImageAllocator bumps a pointer in Utils::LinearAllocator chunks and frees nothing until reset(). It suits
+ *   bulk loads whose images are all uploaded and destroyed before the next batch.
+ *
+ * Both are thread-safe, so they can be shared by the parallel decoding of Image::load.
+ */
+
+#include <array>
+#include <cstddef>
+#include <mutex>
+#include <vector>
+
+#include "LinearAllocator.hpp"
+
+namespace OpenGL::Utils{
+    class ImageAllocator{
+    public:
+        virtual ~ImageAllocator() = default;
+
+        /**
+         * @brief Allocate \p size bytes aligned by \p alignof(std::max_align_t) .
+         * @param size Size in bytes.
+         * @return Allocated memory, \p nullptr if failed.
+         */
+        [[nodiscard]] virtual void *allocate(std::size_t size) noexcept = 0;
+
+        /**
+         * @brief Resize the allocation \p pointer , keeping its contents.
+         * @param pointer Allocated memory, or \p nullptr .
+         * @param old_size Size requested for \p pointer .
+         * @param new_size New size in bytes.
+         * @return Reallocated memory, \p nullptr if failed (and \p pointer is still valid).
+         */
+        [[nodiscard]] virtual void *reallocate(void *pointer, std::size_t old_size, std::size_t new_size) noexcept;
+
+        /**
+         * @brief Free the allocation \p pointer .
+         * @param pointer Allocated memory, or \p nullptr .
+         */
+        virtual void deallocate(void *pointer) noexcept = 0;
+    };
+
+    class PoolImageAllocator final : public ImageAllocator{
+    private:
+        // Each block is preceded by a header, which keeps the alignment of the user memory.
+        struct alignas(std::max_align_t) Header{
+            std::size_t size_class;
+        };
+
+        static constexpr std::size_t min_size_class = 12; // 4 KiB.
+        static constexpr std::size_t size_class_count = 48 - min_size_class;
+
+        std::mutex mutex;
+        std::array<std::vector<Header*>, size_class_count> free_blocks;
+
+    public:
+        PoolImageAllocator() = default;
+        PoolImageAllocator(const PoolImageAllocator&) = delete;
+        ~PoolImageAllocator() noexcept override;
+
+        [[nodiscard]] void *allocate(std::size_t size) noexcept override;
+        void deallocate(void *pointer) noexcept override;
+
+        /**
+         * @brief Free the cached blocks to the system.
+         */
+        void trim() noexcept;
+    };
+
+    class ArenaImageAllocator final : public ImageAllocator{
+    private:
+        std::mutex mutex;
+        LinearAllocator arena;
+
+    public:
+        /**
+         * @brief Construct an empty arena.
+         * @param chunk_size Size of each chunk in bytes, which should be larger than a decoded image.
+         */
+        explicit ArenaImageAllocator(std::size_t chunk_size = 16 * 1024 * 1024) noexcept;
+
+        [[nodiscard]] void *allocate(std::size_t size) noexcept override;
+
+        /**
+         * @brief Do nothing: the memory is released by \p reset .
+         */
+        void deallocate(void *pointer) noexcept override;
+
+        /**
+         * @brief Release every allocation at once, keeping the chunks for the next batch.
+         * @note Every image allocated by this must be destroyed before.
+         */
+        void reset() noexcept;
+    };
+}
@@ -0,0 +1,74 @@
+//
+// Created by gomkyung2 on 2026/10/19.
+//
+
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace OpenGL::Utils{
+    /**
+     * @brief Chunked arena allocator. Allocation is a pointer bump, and every allocation is released at once by \p reset ,
+     * which keeps the chunks for reuse. Not thread-safe: use one allocator per thread.
+     */
+    class LinearAllocator{
+    private:
+        struct Chunk{
+            std::unique_ptr<std::byte[]> data;
+            std::size_t size;
+        };
+
+        std::vector<Chunk> chunks;
+        std::size_t chunk_index = 0; // Index of the chunk being allocated from.
+        std::size_t offset = 0; // Offset in the current chunk.
+        std::size_t chunk_size;
+
+    public:
+        /**
+         * @brief Construct an empty allocator. No memory is allocated until the first allocation.
+         * @param chunk_size Size of each chunk in bytes. Allocations larger than this get their own chunk.
+         */
+        explicit LinearAllocator(std::size_t chunk_size = 64 * 1024) noexcept;
+        LinearAllocator(const LinearAllocator&) = delete;
+        LinearAllocator(LinearAllocator&&) noexcept = default;
+        LinearAllocator &operator=(LinearAllocator&&) noexcept = default;
+
+        /**
+         * @brief Allocate \p size bytes aligned by \p alignment .
+         * @param size Size of the allocation in bytes.
+         * @param alignment Alignment, which must be a power of two not greater than \p alignof(std::max_align_t) .
+         * @return Pointer to the allocated memory, valid until \p reset .
+         */
+        [[nodiscard]] void *allocate(std::size_t size, std::size_t alignment = alignof(std::max_align_t));
+
+        /**
+         * @brief Construct a \p T object in the allocated memory.
+         * @tparam T Object type, which must be trivially destructible since its destructor is never called.
+         * @param args Arguments passed to the constructor of \p T .
+         * @return Pointer to the constructed object, valid until \p reset .
+         */
+        template <typename T, typename... Args> requires std::is_trivially_destructible_v<T>
+        [[nodiscard]] T *create(Args &&...args);
+
+        /**
+         * @brief Release every allocation. The chunks are kept and reused by the subsequent allocations.
+         */
+        void reset() noexcept;
+
+        /**
+         * @brief Get the total size of the allocated chunks.
+         * @return Capacity in bytes.
+         */
+        [[nodiscard]] std::size_t getCapacity() const noexcept;
+    };
+}
+
+template <typename T, typename... Args> requires std::is_trivially_destructible_v<T>
+T *OpenGL::Utils::LinearAllocator::create(Args &&...args) {
+    return new (allocate(sizeof(T), alignof(T))) T { std::forward<Args>(args)... };
+}
@@ -0,0 +1,36 @@
+//
+// Created by gomkyung2 on 2026/10/19.
+//
+
+#pragma once
+
+#include <cstddef>
+#include <span>
+
+namespace OpenGL::Utils{
+    /**
+     * @brief Read-only memory mapping of a whole file, which lets decoders read the file without copying it into a
+     * buffer first.
+     */
+    class MappedFile{
+    private:
+        const std::byte *data = nullptr;
+        std::size_t size = 0;
+#ifdef _WIN32
+        void *file_handle = nullptr;
+        void *mapping_handle = nullptr;
+#endif
+
+    public:
+        /**
+         * @brief Map \p filename into memory.
+         * @param filename File name.
+         * @throw std::runtime_error If the file could not be opened or mapped.
+         */
+        explicit MappedFile(const char *filename);
+        MappedFile(const MappedFile&) = delete;
+        ~MappedFile() noexcept;
+
+        [[nodiscard]] std::span<const std::byte> getBytes() const noexcept;
+    };
+}
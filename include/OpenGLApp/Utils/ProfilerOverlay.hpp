@@ -0,0 +1,47 @@
+//
+// Created by gomkyung2 on 2026/10/19.
+//
+
+#pragma once
+
+/*
+ * ImGui overlay which shows the hierarchical CPU and GPU timings of GpuProfiler.
+ * This header requires Dear ImGui, which is not a dependency of the OpenGLApp library: include it only in the targets
+ * linking imgui. Call drawProfilerOverlay() between ImGui::NewFrame() and ImGui::Render(), see examples/framebuffer.
+ */
+
+#include <imgui.h>
+
+#include "../GpuProfiler.hpp"
+
+namespace OpenGL::Utils{
+    /**
+     * @brief Draw the timings of the latest resolved frame of \p profiler as an ImGui window.
+     * @param profiler Profiler to be shown.
+     * @param title Title of the ImGui window.
+     */
+    inline void drawProfilerOverlay(const GpuProfiler &profiler, const char *title = "Profiler"){
+        ImGui::SetNextWindowPos(ImVec2 { 10.f, 10.f }, ImGuiCond_FirstUseEver);
+        ImGui::SetNextWindowBgAlpha(0.75f);
+        if (ImGui::Begin(title, nullptr, ImGuiWindowFlags_AlwaysAutoResize | ImGuiWindowFlags_NoFocusOnAppearing | ImGuiWindowFlags_NoNav)){
+            if (ImGui::BeginTable("timings", 3, ImGuiTableFlags_Borders | ImGuiTableFlags_RowBg | ImGuiTableFlags_SizingFixedFit)){
+                ImGui::TableSetupColumn("Scope");
+                ImGui::TableSetupColumn("CPU (ms)");
+                ImGui::TableSetupColumn("GPU (ms)");
+                ImGui::TableHeadersRow();
+
+                for (const GpuProfiler::Result &result : profiler.getResults()){
+                    ImGui::TableNextRow();
+                    ImGui::TableNextColumn();
+                    ImGui::Text("%*s%s", static_cast<int>(2 * result.depth), "", result.name);
+                    ImGui::TableNextColumn();
+                    ImGui::Text("%.3f", result.cpu_time);
+                    ImGui::TableNextColumn();
+                    ImGui::Text("%.3f", result.gpu_time);
+                }
+                ImGui::EndTable();
+            }
+        }
+        ImGui::End();
+    }
+}
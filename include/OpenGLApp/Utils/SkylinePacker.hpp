@@ -0,0 +1,48 @@
+//
+// Created by gomkyung2 on 2026/10/19.
+//
+
+#pragma once
+
+#include <optional>
+#include <vector>
+
+#include <glm/vec2.hpp>
+
+namespace OpenGL::Utils{
+    /**
+     * @brief Rectangle packer using the skyline bottom-left heuristic: each rectangle is placed where its top edge is the
+     * lowest, and the leftmost among them. Fast and compact enough for atlases of similarly sized images.
+     */
+    class SkylinePacker{
+    private:
+        struct Segment{
+            int x, y, width;
+        };
+
+        std::vector<Segment> skyline;
+        int width, height;
+        long long used_area = 0;
+
+        std::optional<int> fit(std::size_t segment_index, int rect_width, int rect_height) const;
+
+    public:
+        SkylinePacker(int width, int height);
+
+        /**
+         * @brief Find a place for a rectangle.
+         * @param rect_width Width of the rectangle.
+         * @param rect_height Height of the rectangle.
+         * @return Bottom-left corner of the placed rectangle, \p std::nullopt if there is no space.
+         */
+        std::optional<glm::ivec2> pack(int rect_width, int rect_height);
+
+        void clear();
+
+        /**
+         * @brief Get the ratio of the packed area to the whole area.
+         * @return Occupancy in [0, 1].
+         */
+        [[nodiscard]] float getOccupancy() const noexcept;
+    };
+}
@@ -0,0 +1,56 @@
+//
+// Created by gomkyung2 on 2026/10/19.
+//
+
+#pragma once
+
+#include <algorithm>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace OpenGL::Utils{
+    /**
+     * @brief Fixed-size pool of worker threads for data-parallel CPU work, e.g. image filtering.
+     */
+    class ThreadPool{
+    private:
+        std::mutex mutex;
+        std::condition_variable_any condition;
+        std::deque<std::function<void()>> tasks;
+        std::vector<std::jthread> workers; // Must be declared last, since the workers use the members above.
+
+        void workerMain(std::stop_token stop_token);
+
+    public:
+        /**
+         * @brief Start the worker threads.
+         * @param thread_count Number of worker threads. The thread calling \p parallelFor also runs iterations, so
+         * the default is one less than the hardware concurrency.
+         */
+        explicit ThreadPool(unsigned int thread_count = std::max(std::thread::hardware_concurrency(), 2U) - 1);
+        ThreadPool(const ThreadPool&) = delete;
+        ~ThreadPool() noexcept;
+
+        /**
+         * @brief Call \p function(index) for every index in [0, \p count) in parallel, and wait for them.
+         * @param count Number of iterations.
+         * @param function Function to be called, which must be safe to be called concurrently.
+         * @throw Rethrows the first exception thrown by \p function . The remaining iterations are skipped.
+         * @note Must not be called from \p function , i.e. from a worker thread of the same pool.
+         */
+        void parallelFor(std::size_t count, const std::function<void(std::size_t)> &function);
+
+        [[nodiscard]] std::size_t getThreadCount() const noexcept;
+
+        /**
+         * @brief Get the process-wide pool, which is created on the first call.
+         * @return Default thread pool.
+         */
+        [[nodiscard]] static ThreadPool &getDefault();
+    };
+}
@@ -4,22 +4,93 @@
 
 #pragma once
 
+#include <memory>
+#include <optional>
+
 #include <GL/glew.h>
 #include <GLFW/glfw3.h>
 #include <glm/ext/vector_uint2.hpp>
 
+#include "Input.hpp"
+
 namespace OpenGL{
+    class GoldenImageTest;
+
     class Window{
+    public:
+        struct FixedTimestep{
+            float tick_rate = 60.f; // Number of simulation ticks per second.
+            unsigned int max_ticks_per_frame = 8; // If a frame needs more ticks than this (spiral of death), the rest of the elapsed time is discarded.
+        };
+
+        enum class PresentMode{
+            Immediate, // No vertical synchronization, may tear.
+            VSync, // Wait for vertical blank.
+            AdaptiveVSync, // Wait for vertical blank, but present immediately if the frame is late (EXT_swap_control_tear).
+        };
+
+        struct ContextSettings{
+            int major_version = 3;
+            int minor_version = 3; // 3.3 is the minimum version the library supports.
+            bool core_profile = true; // If false, compatibility profile is requested.
+        };
+
+        struct FrameStatistics{
+            float frame_time = 0.f; // Time between the last two presents in seconds.
+            float input_to_submit_latency = 0.f; // Time from polling the input to returning from glfwSwapBuffers of the frame which used the input, in seconds.
+            float average_input_to_submit_latency = 0.f; // Exponential moving average of input_to_submit_latency.
+        };
+
     private:
         glm::uvec2 size;
         glm::vec<2, GLsizei> framebuffer_size;
 
+        bool pipelined = false;
+        std::optional<FixedTimestep> fixed_timestep = std::nullopt;
+        float accumulated_time = 0.f;
+
+        PresentMode present_mode = PresentMode::VSync;
+        std::optional<float> frame_rate_limit = std::nullopt;
+        double next_frame_time = 0.0;
+        bool low_latency = false;
+        GLsync previous_frame_fence = nullptr;
+        double previous_present_time = 0.0;
+        FrameStatistics frame_statistics;
+        std::unique_ptr<GoldenImageTest> golden_image_test; // nullptr unless the golden image test mode is enabled. See GoldenImageTest.hpp.
+
+        InputEventQueue input_events;
+        InputState input_state;
+
+        void enqueueInputEvent(const InputEvent &event);
+        void dispatchInputEvents();
+        void waitForNextFrame();
+        double pollEvents();
+        void present(double input_time);
+        float advance(float time_delta);
+        void runSerial();
+        void runPipelined();
+
     protected:
         GLFWwindow* const window;
 
         virtual void update(float time_delta) = 0;
-        virtual void draw() const = 0;
 
+        /**
+         * @brief Draw the frame with the interpolation factor between the previous and the current simulation tick.
+         * @param interpolation_alpha If fixed timestep is enabled, the fraction of a tick elapsed since the last tick,
+         * in [0, 1). If it is disabled, 1, since the last update already advanced the state to the current time.
+         */
+        virtual void draw(float interpolation_alpha) const = 0;
+
+        /**
+         * @brief Called in the GL thread after each \p update finished, before the next \p draw starts.
+         * @note In pipelined mode, this is the only point where both update thread and GL thread are synchronized,
+         * therefore the render state written by \p update should be handed to \p draw here.
+         */
+        virtual void publishRenderState();
+
+        // Input event callbacks are called at most once per frame for the coalesced cursor and scroll events, in the GL
+        // thread right after the events are polled. See Input.hpp for the details.
         virtual void onWindowSizeChanged(int width, int height);
         virtual void onFramebufferSizeChanged(int width, int height);
         virtual void onKeyChanged(int key, int scancode, int action, int mods);
@@ -27,15 +98,83 @@ namespace OpenGL{
         virtual void onCursorPosChanged(double xpos, double ypos);
         virtual void onScrollChanged(double xoffset, double yoffset);
 
+        /**
+         * @brief Enable or disable pipelined update/render.
+         * @param enabled If \p true, \p update for frame N+1 runs in a worker thread while \p draw for frame N runs in
+         * the GL thread.
+         * @note In pipelined mode, \p update must not call any OpenGL function (including \p Program::setUniform ), and
+         * must not modify the state which \p draw reads except through \p publishRenderState . Event callbacks are
+         * still called in the GL thread while the worker thread is idle. See PipelinedWindow.hpp for the helper class.
+         */
+        void setPipelined(bool enabled) noexcept;
+
+        /**
+         * @brief Enable or disable fixed-timestep simulation.
+         * @param timestep If not \p std::nullopt , \p update is called zero or more times per frame with the constant
+         * time delta 1 / \p tick_rate , and \p draw receives the fraction of the remaining accumulated time.
+         * If \p std::nullopt , \p update is called once per frame with the variable elapsed time.
+         * @throw std::runtime_error If \p tick_rate is not positive.
+         */
+        void setFixedTimestep(std::optional<FixedTimestep> timestep);
+
     public:
         Window(int width, int height, const char *title);
+
+        /**
+         * @brief Create a window with the requested context version and profile.
+         * @param context_settings Requested context. If it cannot be created, lower versions down to 3.3 are tried in
+         * order. The version actually created is reported by \p Capabilities::get() .
+         * @throw std::runtime_error If the requested version is earlier than 3.3, or no context of 3.3 or later can be
+         * created.
+         */
+        Window(int width, int height, const char *title, const ContextSettings &context_settings);
         virtual ~Window() noexcept;
 
+        /**
+         * @brief Run the main loop until the window is closed.
+         * @throw std::runtime_error In the golden image test mode, if the last frame does not match the reference.
+         */
         void run();
 
+        /**
+         * @brief Set the swap interval of the window.
+         * @param mode Requested present mode.
+         * @return Applied present mode. \p AdaptiveVSync falls back to \p VSync if EXT_swap_control_tear is not supported.
+         */
+        PresentMode setPresentMode(PresentMode mode);
+
+        /**
+         * @brief Limit the frame rate.
+         * @param frames_per_second Maximum frame rate, or \p std::nullopt for unlimited.
+         * @note The limiter sleeps until shortly before the deadline and spins for the rest, so it is accurate regardless
+         * of the OS scheduler granularity, at the cost of a little CPU time.
+         * @throw std::runtime_error If \p frames_per_second is not positive.
+         */
+        void setFrameRateLimit(std::optional<float> frames_per_second);
+
+        /**
+         * @brief Enable or disable low-latency mode.
+         * @param enabled If \p true , wait for the GPU to finish the previous frame before polling the input, so that the
+         * CPU cannot run ahead of the GPU and the input is sampled as late as possible.
+         * @note This trades throughput for latency. It is most effective with \p VSync and a frame rate limit.
+         */
+        void setLowLatencyMode(bool enabled) noexcept;
+
+        [[nodiscard]] PresentMode getPresentMode() const noexcept;
+        [[nodiscard]] const FrameStatistics &getFrameStatistics() const noexcept;
+        [[nodiscard]] bool isPipelined() const noexcept;
+
+        /**
+         * @brief Get the input state aggregated from the events of the current frame.
+         * @return Input state.
+         * @note The state is updated only between frames, so it is safe to read in \p update , even in pipelined mode.
+         * Cursor and scroll deltas are reset after each \p update , so they are applied once even if \p update runs
+         * several times per frame.
+         */
+        [[nodiscard]] const InputState &getInputState() const noexcept;
         [[nodiscard]] glm::uvec2 getSize() const noexcept;
         [[nodiscard]] glm::vec<2, GLsizei> getFramebufferSize() const noexcept;
         [[nodiscard]] float getAspectRatio() const noexcept;
         [[nodiscard]] float getFramebufferAspectRatio() const noexcept;
     };
-}
\ No newline at end of file
+}
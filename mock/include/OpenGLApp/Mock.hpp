@@ -0,0 +1,89 @@
+//
+// Created by gomkyung2 on 2026/10/19.
+//
+
+#pragma once
+
+/* SYNOPSIS.
+ *
+ * Recording mock GL backend, which is linked in place of GLEW, GLFW and the system GL library (target OpenGLApp_Mock,
+ * built when OPENGLAPP_BUILD_MOCK is ON). It defines the GLEW function pointers, the GL 1.1 entry points and the GLFW
+ * functions used by the library, so its CPU-side logic can be tested and benchmarked without a GPU.
+ *
+ * - Every GL call is recorded with its arguments, which can be inspected by getCalls(). Recording can be turned off by
+ *   setRecording(false), e.g. for measuring the CPU overhead of the library itself.
+ * - Object names (shaders, programs, buffers, textures, ...) are generated and deleted like GL does.
+ * - Shader compilation succeeds unless the source contains an #error directive. Linking succeeds if a vertex shader and
+ *   a fragment shader are attached and compiled, or for separable programs (GL_PROGRAM_SEPARABLE), if any compiled
+ *   shader is attached.
+ * - Active uniforms, attributes and uniform blocks are reflected from the plain declarations in the attached shader
+ *   sources (e.g. "uniform mat4 model;", "layout (location = 0) in vec3 inPosition;"), and uniform values set by
+ *   glUniform* can be read back by glGetUniform*.
+ * - Buffer contents are stored in memory, so glMapBufferRange returns a valid pointer.
+ * - Fences are always signaled, and timer queries return zero.
+ * - Windows never close by themselves. Use setSwapLimit() so that Window::run() returns after a number of frames, and
+ *   the send*() functions to inject input events.
+ *
+ * The tests in tests/MockTest.cpp check the call streams of the library this way, and are registered to CTest when
+ * OPENGLAPP_BUILD_MOCK is ON.
+ */
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <string_view>
+#include <variant>
+#include <vector>
+
+#include <GL/glew.h>
+#include <GLFW/glfw3.h>
+
+namespace OpenGL::Mock{
+    // Integral arguments (including enums and names) are widened to std::int64_t, floating point ones to double.
+    using Argument = std::variant<std::int64_t, double, const void*>;
+
+    struct Call{
+        std::string_view name; // Entry point name, e.g. "glUseProgram".
+        std::vector<Argument> arguments;
+    };
+
+    /**
+     * @brief Get the recorded GL calls since the last clearCalls().
+     * @return Recorded calls in the order of issue.
+     */
+    [[nodiscard]] std::span<const Call> getCalls() noexcept;
+
+    /**
+     * @brief Count the recorded calls of the given entry point.
+     * @param name Entry point name, e.g. "glUseProgram".
+     * @return Number of calls.
+     */
+    [[nodiscard]] std::size_t countCalls(std::string_view name) noexcept;
+
+    void clearCalls() noexcept;
+
+    /**
+     * @brief Enable or disable the call recording. The simulated state is updated regardless. Enabled by default.
+     * @param recording \p true if the calls should be recorded.
+     */
+    void setRecording(bool recording) noexcept;
+
+    /**
+     * @brief Destroy every simulated GL object and clear the recorded calls.
+     */
+    void reset();
+
+    /**
+     * @brief Make glfwWindowShouldClose return \p true after glfwSwapBuffers is called \p swap_count times for the
+     * window.
+     * @param window Window to be closed.
+     * @param swap_count Number of swaps before closing.
+     */
+    void setSwapLimit(GLFWwindow *window, std::size_t swap_count) noexcept;
+
+    void sendKey(GLFWwindow *window, int key, int action, int mods = 0);
+    void sendMouseButton(GLFWwindow *window, int button, int action, int mods = 0);
+    void sendCursorPos(GLFWwindow *window, double x, double y);
+    void sendScroll(GLFWwindow *window, double x_offset, double y_offset);
+    void sendFramebufferSize(GLFWwindow *window, int width, int height);
+}
@@ -0,0 +1,959 @@
+//
+// Created by gomkyung2 on 2026/10/19.
+//
+
+#include "OpenGLApp/Mock.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cstring>
+#include <map>
+#include <optional>
+#include <regex>
+#include <string>
+#include <type_traits>
+#include <unordered_map>
+#include <unordered_set>
+
+namespace{
+    template <std::size_t N>
+    struct EntryName{
+        char value[N];
+
+        constexpr EntryName(const char (&name)[N]) {
+            std::copy_n(name, N, value);
+        }
+
+        [[nodiscard]] constexpr std::string_view view() const noexcept {
+            return { value, N - 1 };
+        }
+    };
+
+    struct TypeInfo{
+        std::string_view name;
+        GLenum type;
+        std::size_t size; // in bytes.
+    };
+
+    constexpr std::array type_infos {
+        TypeInfo { "float", GL_FLOAT, 4 }, TypeInfo { "vec2", GL_FLOAT_VEC2, 8 }, TypeInfo { "vec3", GL_FLOAT_VEC3, 12 }, TypeInfo { "vec4", GL_FLOAT_VEC4, 16 },
+        TypeInfo { "int", GL_INT, 4 }, TypeInfo { "ivec2", GL_INT_VEC2, 8 }, TypeInfo { "ivec3", GL_INT_VEC3, 12 }, TypeInfo { "ivec4", GL_INT_VEC4, 16 },
+        TypeInfo { "uint", GL_UNSIGNED_INT, 4 }, TypeInfo { "uvec2", GL_UNSIGNED_INT_VEC2, 8 }, TypeInfo { "uvec3", GL_UNSIGNED_INT_VEC3, 12 }, TypeInfo { "uvec4", GL_UNSIGNED_INT_VEC4, 16 },
+        TypeInfo { "bool", GL_BOOL, 4 }, TypeInfo { "bvec2", GL_BOOL_VEC2, 8 }, TypeInfo { "bvec3", GL_BOOL_VEC3, 12 }, TypeInfo { "bvec4", GL_BOOL_VEC4, 16 },
+        TypeInfo { "mat2", GL_FLOAT_MAT2, 16 }, TypeInfo { "mat3", GL_FLOAT_MAT3, 36 }, TypeInfo { "mat4", GL_FLOAT_MAT4, 64 },
+        TypeInfo { "mat2x3", GL_FLOAT_MAT2x3, 24 }, TypeInfo { "mat2x4", GL_FLOAT_MAT2x4, 32 }, TypeInfo { "mat3x2", GL_FLOAT_MAT3x2, 24 },
+        TypeInfo { "mat3x4", GL_FLOAT_MAT3x4, 48 }, TypeInfo { "mat4x2", GL_FLOAT_MAT4x2, 32 }, TypeInfo { "mat4x3", GL_FLOAT_MAT4x3, 48 },
+        TypeInfo { "sampler1D", GL_SAMPLER_1D, 4 }, TypeInfo { "sampler2D", GL_SAMPLER_2D, 4 }, TypeInfo { "sampler3D", GL_SAMPLER_3D, 4 },
+        TypeInfo { "samplerCube", GL_SAMPLER_CUBE, 4 }, TypeInfo { "sampler2DShadow", GL_SAMPLER_2D_SHADOW, 4 },
+        TypeInfo { "sampler2DArray", GL_SAMPLER_2D_ARRAY, 4 }, TypeInfo { "sampler2DMS", GL_SAMPLER_2D_MULTISAMPLE, 4 },
+        TypeInfo { "samplerBuffer", GL_SAMPLER_BUFFER, 4 }, TypeInfo { "isampler2D", GL_INT_SAMPLER_2D, 4 },
+        TypeInfo { "isamplerBuffer", GL_INT_SAMPLER_BUFFER, 4 }, TypeInfo { "usampler2D", GL_UNSIGNED_INT_SAMPLER_2D, 4 },
+        TypeInfo { "usamplerBuffer", GL_UNSIGNED_INT_SAMPLER_BUFFER, 4 },
+    };
+
+    struct Shader{
+        GLenum type;
+        std::string source;
+        bool compiled = false;
+        bool delete_pending = false;
+        std::string info_log;
+    };
+
+    struct Variable{
+        std::string name; // Arrays are suffixed by "[0]", like glGetActiveUniform reports.
+        GLenum type;
+        GLint size;
+        GLint location;
+        std::size_t element_size;
+    };
+
+    struct Program{
+        std::vector<GLuint> attached_shaders;
+        bool separable = false;
+        bool linked = false;
+        std::string info_log;
+        std::vector<Variable> uniforms, attributes;
+        std::vector<std::string> uniform_blocks;
+        std::vector<GLuint> uniform_block_bindings; // Indexed by the uniform block index.
+        std::map<GLint, std::vector<std::byte>> uniform_values;
+    };
+
+    struct NamePool{
+        GLuint next = 1;
+        std::unordered_set<GLuint> alive;
+    };
+
+    struct Context{
+        std::vector<OpenGL::Mock::Call> calls;
+        bool recording = true;
+
+        GLuint next_shader_program_name = 1; // Shaders and programs share their name space.
+        std::unordered_map<GLuint, Shader> shaders;
+        std::unordered_map<GLuint, Program> programs;
+        GLuint current_program = 0;
+
+        GLuint next_buffer_name = 1;
+        std::unordered_map<GLuint, std::vector<std::byte>> buffers;
+        std::unordered_map<GLenum, GLuint> buffer_bindings;
+
+        NamePool vertex_arrays, textures, framebuffers, renderbuffers, queries, program_pipelines;
+        GLenum active_texture = GL_TEXTURE0;
+        std::uintptr_t next_sync = 1;
+    } context;
+
+    template <typename T>
+    OpenGL::Mock::Argument toArgument(T value) {
+        if constexpr (std::is_pointer_v<T> && std::is_function_v<std::remove_pointer_t<T>>){
+            return reinterpret_cast<const void*>(value);
+        }
+        else if constexpr (std::is_pointer_v<T>){
+            return static_cast<const void*>(value);
+        }
+        else if constexpr (std::is_floating_point_v<T>){
+            return static_cast<double>(value);
+        }
+        else{
+            return static_cast<std::int64_t>(value);
+        }
+    }
+
+    template <typename... Args>
+    void record(std::string_view name, Args... args) {
+        if (context.recording){
+            context.calls.emplace_back(name, std::vector<OpenGL::Mock::Argument> { toArgument(args)... });
+        }
+    }
+
+    // Entry<Name, F, implementation>::call has the signature of F, records the call and forwards it to implementation, or
+    // returns a value-initialized result if there is no implementation.
+    template <EntryName Name, typename Function, auto implementation = nullptr>
+    struct Entry;
+
+    template <EntryName Name, typename R, typename... Args, auto implementation>
+    struct Entry<Name, R (APIENTRY *)(Args...), implementation>{
+        static R APIENTRY call(Args... args) {
+            record(Name.view(), args...);
+            if constexpr (std::is_null_pointer_v<decltype(implementation)>){
+                if constexpr (!std::is_void_v<R>){
+                    return R {};
+                }
+            }
+            else{
+                return implementation(args...);
+            }
+        }
+    };
+
+    void copyInfoLog(std::string_view info_log, GLsizei buffer_size, GLsizei *length, GLchar *out) {
+        if (buffer_size <= 0){
+            return;
+        }
+
+        const auto copied_length = std::min<std::size_t>(info_log.size(), buffer_size - 1);
+        std::copy_n(info_log.data(), copied_length, out);
+        out[copied_length] = '\0';
+        if (length){
+            *length = static_cast<GLsizei>(copied_length);
+        }
+    }
+
+    std::string stripComments(const std::string &source) {
+        static const std::regex comment_regex { R"(//[^\n]*|/\*[\s\S]*?\*/)" };
+        return std::regex_replace(source, comment_regex, " ");
+    }
+
+    const TypeInfo *findTypeInfo(std::string_view name) {
+        const auto it = std::ranges::find(type_infos, name, &TypeInfo::name);
+        return it == type_infos.end() ? nullptr : &*it;
+    }
+
+    void reflect(Program &program) {
+        static const std::regex uniform_regex { R"(\buniform\s+(?:(?:lowp|mediump|highp)\s+)?(\w+)\s+(\w+)\s*(?:\[\s*(\d+)\s*\])?\s*;)" };
+        static const std::regex uniform_block_regex { R"(\buniform\s+(\w+)\s*\{)" };
+        static const std::regex attribute_regex { R"((?:layout\s*\(\s*location\s*=\s*(\d+)\s*\)\s*)?\bin\s+(\w+)\s+(\w+)\s*;)" };
+
+        program.uniforms.clear();
+        program.attributes.clear();
+        program.uniform_blocks.clear();
+
+        GLint next_uniform_location = 0, next_attribute_location = 0;
+        for (GLuint shader_name : program.attached_shaders){
+            const Shader &shader = context.shaders.at(shader_name);
+            const std::string source = stripComments(shader.source);
+
+            for (auto it = std::sregex_iterator { source.begin(), source.end(), uniform_regex }; it != std::sregex_iterator {}; ++it){
+                const TypeInfo *type_info = findTypeInfo((*it)[1].str());
+                const GLint size = (*it)[3].matched ? std::stoi((*it)[3].str()) : 1;
+                std::string name = (*it)[2].str() + (size > 1 ? "[0]" : "");
+                if (!type_info || std::ranges::find(program.uniforms, name, &Variable::name) != program.uniforms.end()){
+                    continue; // Struct uniforms are not supported, and uniforms shared by the stages are listed once.
+                }
+
+                program.uniforms.emplace_back(std::move(name), type_info->type, size, next_uniform_location, type_info->size);
+                next_uniform_location += size;
+            }
+
+            for (auto it = std::sregex_iterator { source.begin(), source.end(), uniform_block_regex }; it != std::sregex_iterator {}; ++it){
+                if (std::ranges::find(program.uniform_blocks, (*it)[1].str()) == program.uniform_blocks.end()){
+                    program.uniform_blocks.push_back((*it)[1].str());
+                }
+            }
+            program.uniform_block_bindings.assign(program.uniform_blocks.size(), 0);
+
+            if (shader.type == GL_VERTEX_SHADER){
+                for (auto it = std::sregex_iterator { source.begin(), source.end(), attribute_regex }; it != std::sregex_iterator {}; ++it){
+                    const TypeInfo *type_info = findTypeInfo((*it)[2].str());
+                    if (!type_info){
+                        continue;
+                    }
+
+                    const GLint location = (*it)[1].matched ? std::stoi((*it)[1].str()) : next_attribute_location;
+                    program.attributes.emplace_back((*it)[3].str(), type_info->type, 1, location, type_info->size);
+                    next_attribute_location = location + 1;
+                }
+            }
+        }
+    }
+
+    const Variable *findUniformAt(const Program &program, GLint location) {
+        const auto it = std::ranges::find_if(program.uniforms, [=](const Variable &uniform){
+            return uniform.location <= location && location < uniform.location + uniform.size;
+        });
+        return it == program.uniforms.end() ? nullptr : &*it;
+    }
+
+    void eraseDeletedShaders() {
+        std::erase_if(context.shaders, [](const auto &pair){
+            return pair.second.delete_pending && std::ranges::none_of(context.programs, [&](const auto &program){
+                return std::ranges::find(program.second.attached_shaders, pair.first) != program.second.attached_shaders.end();
+            });
+        });
+    }
+
+    void storeUniform(GLuint program_name, GLint location, GLsizei count, const void *value, std::size_t element_size) {
+        const auto program = context.programs.find(program_name);
+        if (program == context.programs.end() || location < 0){
+            return;
+        }
+
+        const auto *bytes = static_cast<const std::byte*>(value);
+        for (GLsizei index = 0; index < count; ++index){
+            program->second.uniform_values[location + index].assign(bytes + index * element_size, bytes + (index + 1) * element_size);
+        }
+    }
+
+    template <typename T>
+    void loadUniform(GLuint program_name, GLint location, T *params) {
+        const auto program = context.programs.find(program_name);
+        if (program == context.programs.end()){
+            return;
+        }
+
+        if (auto it = program->second.uniform_values.find(location); it != program->second.uniform_values.end()){
+            std::memcpy(params, it->second.data(), it->second.size());
+        }
+        else if (const Variable *uniform = findUniformAt(program->second, location)){
+            std::memset(params, 0, uniform->element_size); // Default uniform value is zero.
+        }
+    }
+
+    /* Shader and program objects. */
+
+    GLuint simulateCreateShader(GLenum type) {
+        const GLuint name = context.next_shader_program_name++;
+        context.shaders.emplace(name, Shader { .type = type });
+        return name;
+    }
+
+    void simulateDeleteShader(GLuint name) {
+        if (auto it = context.shaders.find(name); it != context.shaders.end()){
+            it->second.delete_pending = true;
+            eraseDeletedShaders();
+        }
+    }
+
+    void simulateShaderSource(GLuint name, GLsizei count, const GLchar *const *strings, const GLint *lengths) {
+        Shader &shader = context.shaders.at(name);
+        shader.source.clear();
+        for (GLsizei index = 0; index < count; ++index){
+            if (lengths && lengths[index] >= 0){
+                shader.source.append(strings[index], lengths[index]);
+            }
+            else{
+                shader.source.append(strings[index]);
+            }
+        }
+    }
+
+    void simulateCompileShader(GLuint name) {
+        Shader &shader = context.shaders.at(name);
+        shader.compiled = shader.source.find("#error") == std::string::npos;
+        shader.info_log = shader.compiled ? "" : "0:1(1): error: #error directive";
+    }
+
+    void simulateGetShaderiv(GLuint name, GLenum parameter, GLint *params) {
+        const Shader &shader = context.shaders.at(name);
+        switch (parameter){
+            case GL_SHADER_TYPE: *params = static_cast<GLint>(shader.type); break;
+            case GL_COMPILE_STATUS: *params = shader.compiled; break;
+            case GL_DELETE_STATUS: *params = shader.delete_pending; break;
+            case GL_INFO_LOG_LENGTH: *params = shader.info_log.empty() ? 0 : static_cast<GLint>(shader.info_log.size() + 1); break;
+            case GL_SHADER_SOURCE_LENGTH: *params = shader.source.empty() ? 0 : static_cast<GLint>(shader.source.size() + 1); break;
+            case GL_COMPLETION_STATUS_KHR: *params = GL_TRUE; break;
+            default: break;
+        }
+    }
+
+    void simulateGetShaderInfoLog(GLuint name, GLsizei buffer_size, GLsizei *length, GLchar *info_log) {
+        copyInfoLog(context.shaders.at(name).info_log, buffer_size, length, info_log);
+    }
+
+    GLuint simulateCreateProgram() {
+        const GLuint name = context.next_shader_program_name++;
+        context.programs.emplace(name, Program {});
+        return name;
+    }
+
+    void simulateDeleteProgram(GLuint name) {
+        context.programs.erase(name);
+        eraseDeletedShaders();
+    }
+
+    void simulateAttachShader(GLuint program, GLuint shader) {
+        context.programs.at(program).attached_shaders.push_back(shader);
+    }
+
+    void simulateDetachShader(GLuint program, GLuint shader) {
+        std::erase(context.programs.at(program).attached_shaders, shader);
+        eraseDeletedShaders();
+    }
+
+    void simulateLinkProgram(GLuint name) {
+        Program &program = context.programs.at(name);
+        program.uniform_values.clear();
+
+        bool has_vertex_shader = false, has_fragment_shader = false;
+        for (GLuint shader_name : program.attached_shaders){
+            const Shader &shader = context.shaders.at(shader_name);
+            if (!shader.compiled){
+                program.linked = false;
+                program.info_log = "error: linking with uncompiled shader";
+                return;
+            }
+            has_vertex_shader |= shader.type == GL_VERTEX_SHADER;
+            has_fragment_shader |= shader.type == GL_FRAGMENT_SHADER;
+        }
+
+        // Separable programs may have any subset of the stages.
+        program.linked = program.separable ? !program.attached_shaders.empty() : has_vertex_shader && has_fragment_shader;
+        program.info_log = program.linked ? "" : "error: program lacks a vertex or fragment shader";
+        if (program.linked){
+            reflect(program);
+        }
+    }
+
+    void simulateProgramParameteri(GLuint name, GLenum parameter, GLint value) {
+        if (parameter == GL_PROGRAM_SEPARABLE){
+            context.programs.at(name).separable = value != GL_FALSE;
+        }
+    }
+
+    void simulateUseProgram(GLuint name) {
+        context.current_program = name;
+    }
+
+    void simulateGetProgramiv(GLuint name, GLenum parameter, GLint *params) {
+        const Program &program = context.programs.at(name);
+        const auto max_name_length = [](const std::vector<Variable> &variables){
+            const auto it = std::ranges::max_element(variables, {}, [](const Variable &variable) { return variable.name.size(); });
+            return it == variables.end() ? 0 : static_cast<GLint>(it->name.size() + 1);
+        };
+
+        switch (parameter){
+            case GL_LINK_STATUS: *params = program.linked; break;
+            case GL_PROGRAM_SEPARABLE: *params = program.separable; break;
+            case GL_INFO_LOG_LENGTH: *params = program.info_log.empty() ? 0 : static_cast<GLint>(program.info_log.size() + 1); break;
+            case GL_ATTACHED_SHADERS: *params = static_cast<GLint>(program.attached_shaders.size()); break;
+            case GL_ACTIVE_UNIFORMS: *params = static_cast<GLint>(program.uniforms.size()); break;
+            case GL_ACTIVE_UNIFORM_MAX_LENGTH: *params = max_name_length(program.uniforms); break;
+            case GL_ACTIVE_ATTRIBUTES: *params = static_cast<GLint>(program.attributes.size()); break;
+            case GL_ACTIVE_ATTRIBUTE_MAX_LENGTH: *params = max_name_length(program.attributes); break;
+            case GL_ACTIVE_UNIFORM_BLOCKS: *params = static_cast<GLint>(program.uniform_blocks.size()); break;
+            case GL_ACTIVE_UNIFORM_BLOCK_MAX_NAME_LENGTH: {
+                const auto it = std::ranges::max_element(program.uniform_blocks, {}, &std::string::size);
+                *params = it == program.uniform_blocks.end() ? 0 : static_cast<GLint>(it->size() + 1);
+                break;
+            }
+            case GL_COMPLETION_STATUS_KHR: *params = GL_TRUE; break;
+            default: break;
+        }
+    }
+
+    void simulateGetProgramInfoLog(GLuint name, GLsizei buffer_size, GLsizei *length, GLchar *info_log) {
+        copyInfoLog(context.programs.at(name).info_log, buffer_size, length, info_log);
+    }
+
+    template <std::vector<Variable> Program::*variables>
+    void simulateGetActiveVariable(GLuint name, GLuint index, GLsizei buffer_size, GLsizei *length, GLint *size, GLenum *type, GLchar *variable_name) {
+        const Variable &variable = (context.programs.at(name).*variables).at(index);
+        copyInfoLog(variable.name, buffer_size, length, variable_name);
+        *size = variable.size;
+        *type = variable.type;
+    }
+
+    GLint simulateGetUniformLocation(GLuint name, const GLchar *uniform_name) {
+        // "name", "name[0]" and "name[i]" are all valid for arrays.
+        std::string_view base_name = uniform_name;
+        GLint element_index = 0;
+        if (base_name.ends_with(']')){
+            const std::size_t subscript_pos = base_name.rfind('[');
+            element_index = std::stoi(std::string { base_name.substr(subscript_pos + 1) });
+            base_name = base_name.substr(0, subscript_pos);
+        }
+
+        for (const Variable &uniform : context.programs.at(name).uniforms){
+            const std::string_view uniform_base_name = std::string_view { uniform.name }.substr(0, uniform.name.find('['));
+            if (uniform_base_name == base_name && element_index < uniform.size){
+                return uniform.location + element_index;
+            }
+        }
+        return -1;
+    }
+
+    GLint simulateGetAttribLocation(GLuint name, const GLchar *attribute_name) {
+        const std::vector<Variable> &attributes = context.programs.at(name).attributes;
+        const auto it = std::ranges::find(attributes, std::string_view { attribute_name }, &Variable::name);
+        return it == attributes.end() ? -1 : it->location;
+    }
+
+    GLuint simulateGetUniformBlockIndex(GLuint name, const GLchar *block_name) {
+        const std::vector<std::string> &blocks = context.programs.at(name).uniform_blocks;
+        const auto it = std::ranges::find(blocks, std::string_view { block_name });
+        return it == blocks.end() ? GL_INVALID_INDEX : static_cast<GLuint>(it - blocks.begin());
+    }
+
+    void simulateGetActiveUniformBlockName(GLuint name, GLuint index, GLsizei buffer_size, GLsizei *length, GLchar *block_name) {
+        copyInfoLog(context.programs.at(name).uniform_blocks.at(index), buffer_size, length, block_name);
+    }
+
+    void simulateGetActiveUniformBlockiv(GLuint name, GLuint index, GLenum parameter, GLint *params) {
+        if (parameter == GL_UNIFORM_BLOCK_BINDING){
+            *params = static_cast<GLint>(context.programs.at(name).uniform_block_bindings.at(index));
+        }
+    }
+
+    void simulateUniformBlockBinding(GLuint name, GLuint index, GLuint binding) {
+        context.programs.at(name).uniform_block_bindings.at(index) = binding;
+    }
+
+    /* Uniforms. */
+
+    template <typename... T>
+    void simulateUniformValues(GLint location, T... values) {
+        const std::array value_array { values... };
+        storeUniform(context.current_program, location, 1, value_array.data(), sizeof(value_array));
+    }
+
+    template <typename T, std::size_t N>
+    void simulateUniformVector(GLint location, GLsizei count, const T *value) {
+        storeUniform(context.current_program, location, count, value, sizeof(T) * N);
+    }
+
+    // Transposition is not simulated: the values are stored as given.
+    template <std::size_t Columns, std::size_t Rows>
+    void simulateUniformMatrix(GLint location, GLsizei count, GLboolean, const GLfloat *value) {
+        storeUniform(context.current_program, location, count, value, sizeof(GLfloat) * Columns * Rows);
+    }
+
+    template <typename... T>
+    void simulateProgramUniformValues(GLuint program, GLint location, T... values) {
+        const std::array value_array { values... };
+        storeUniform(program, location, 1, value_array.data(), sizeof(value_array));
+    }
+
+    template <typename T, std::size_t N>
+    void simulateProgramUniformVector(GLuint program, GLint location, GLsizei count, const T *value) {
+        storeUniform(program, location, count, value, sizeof(T) * N);
+    }
+
+    template <std::size_t Columns, std::size_t Rows>
+    void simulateProgramUniformMatrix(GLuint program, GLint location, GLsizei count, GLboolean, const GLfloat *value) {
+        storeUniform(program, location, count, value, sizeof(GLfloat) * Columns * Rows);
+    }
+
+    /* Buffers. */
+
+    void simulateGenBuffers(GLsizei n, GLuint *names) {
+        for (GLsizei index = 0; index < n; ++index){
+            names[index] = context.next_buffer_name++;
+            context.buffers.emplace(names[index], std::vector<std::byte> {});
+        }
+    }
+
+    void simulateDeleteBuffers(GLsizei n, const GLuint *names) {
+        for (GLsizei index = 0; index < n; ++index){
+            context.buffers.erase(names[index]);
+            std::erase_if(context.buffer_bindings, [&](const auto &pair) { return pair.second == names[index]; });
+        }
+    }
+
+    void simulateBindBuffer(GLenum target, GLuint name) {
+        context.buffer_bindings[target] = name;
+    }
+
+    void simulateBindBufferBase(GLenum target, GLuint, GLuint name) {
+        context.buffer_bindings[target] = name;
+    }
+
+    void simulateBindBufferRange(GLenum target, GLuint, GLuint name, GLintptr, GLsizeiptr) {
+        context.buffer_bindings[target] = name;
+    }
+
+    std::vector<std::byte> *findBoundBuffer(GLenum target) {
+        const auto binding = context.buffer_bindings.find(target);
+        if (binding == context.buffer_bindings.end()){
+            return nullptr;
+        }
+
+        const auto buffer = context.buffers.find(binding->second);
+        return buffer == context.buffers.end() ? nullptr : &buffer->second;
+    }
+
+    void simulateBufferData(GLenum target, GLsizeiptr size, const void *data, GLenum) {
+        if (std::vector<std::byte> *buffer = findBoundBuffer(target)){
+            buffer->assign(static_cast<std::size_t>(size), std::byte {});
+            if (data){
+                std::memcpy(buffer->data(), data, static_cast<std::size_t>(size));
+            }
+        }
+    }
+
+    void simulateBufferStorage(GLenum target, GLsizeiptr size, const void *data, GLbitfield) {
+        simulateBufferData(target, size, data, GL_STATIC_DRAW);
+    }
+
+    void simulateBufferSubData(GLenum target, GLintptr offset, GLsizeiptr size, const void *data) {
+        if (std::vector<std::byte> *buffer = findBoundBuffer(target); buffer && static_cast<std::size_t>(offset + size) <= buffer->size()){
+            std::memcpy(buffer->data() + offset, data, static_cast<std::size_t>(size));
+        }
+    }
+
+    void simulateGetBufferSubData(GLenum target, GLintptr offset, GLsizeiptr size, void *data) {
+        if (std::vector<std::byte> *buffer = findBoundBuffer(target); buffer && static_cast<std::size_t>(offset + size) <= buffer->size()){
+            std::memcpy(data, buffer->data() + offset, static_cast<std::size_t>(size));
+        }
+    }
+
+    std::vector<std::byte> *findBuffer(GLuint name) {
+        const auto buffer = context.buffers.find(name);
+        return buffer == context.buffers.end() ? nullptr : &buffer->second;
+    }
+
+    void simulateNamedBufferData(GLuint name, GLsizeiptr size, const void *data, GLenum) {
+        if (std::vector<std::byte> *buffer = findBuffer(name)){
+            buffer->assign(static_cast<std::size_t>(size), std::byte {});
+            if (data){
+                std::memcpy(buffer->data(), data, static_cast<std::size_t>(size));
+            }
+        }
+    }
+
+    void simulateNamedBufferStorage(GLuint name, GLsizeiptr size, const void *data, GLbitfield) {
+        simulateNamedBufferData(name, size, data, GL_STATIC_DRAW);
+    }
+
+    void simulateNamedBufferSubData(GLuint name, GLintptr offset, GLsizeiptr size, const void *data) {
+        if (std::vector<std::byte> *buffer = findBuffer(name); buffer && static_cast<std::size_t>(offset + size) <= buffer->size()){
+            std::memcpy(buffer->data() + offset, data, static_cast<std::size_t>(size));
+        }
+    }
+
+    void *simulateMapNamedBufferRange(GLuint name, GLintptr offset, GLsizeiptr length, GLbitfield) {
+        std::vector<std::byte> *buffer = findBuffer(name);
+        return buffer && static_cast<std::size_t>(offset + length) <= buffer->size() ? buffer->data() + offset : nullptr;
+    }
+
+    GLboolean simulateUnmapNamedBuffer(GLuint) {
+        return GL_TRUE;
+    }
+
+    void *simulateMapBufferRange(GLenum target, GLintptr offset, GLsizeiptr length, GLbitfield) {
+        std::vector<std::byte> *buffer = findBoundBuffer(target);
+        return buffer && static_cast<std::size_t>(offset + length) <= buffer->size() ? buffer->data() + offset : nullptr;
+    }
+
+    GLboolean simulateUnmapBuffer(GLenum) {
+        return GL_TRUE;
+    }
+
+    /* Other objects. */
+
+    template <NamePool Context::*pool>
+    void simulateGenNames(GLsizei n, GLuint *names) {
+        for (GLsizei index = 0; index < n; ++index){
+            names[index] = (context.*pool).next++;
+            (context.*pool).alive.insert(names[index]);
+        }
+    }
+
+    template <NamePool Context::*pool>
+    void simulateDeleteNames(GLsizei n, const GLuint *names) {
+        for (GLsizei index = 0; index < n; ++index){
+            (context.*pool).alive.erase(names[index]);
+        }
+    }
+
+    template <NamePool Context::*pool>
+    void simulateCreateNames(GLenum, GLsizei n, GLuint *names) {
+        simulateGenNames<pool>(n, names);
+    }
+
+    void simulateActiveTexture(GLenum texture) {
+        context.active_texture = texture;
+    }
+
+    GLenum simulateCheckFramebufferStatus(GLenum) {
+        return GL_FRAMEBUFFER_COMPLETE;
+    }
+
+    GLsync simulateFenceSync(GLenum, GLbitfield) {
+        return reinterpret_cast<GLsync>(context.next_sync++);
+    }
+
+    GLenum simulateClientWaitSync(GLsync, GLbitfield, GLuint64) {
+        return GL_ALREADY_SIGNALED;
+    }
+
+    void simulateGetQueryObjectiv(GLuint, GLenum parameter, GLint *params) {
+        *params = parameter == GL_QUERY_RESULT_AVAILABLE ? GL_TRUE : 0;
+    }
+
+    void simulateGetQueryObjectui64v(GLuint, GLenum, GLuint64 *params) {
+        *params = 0;
+    }
+
+    const GLubyte *simulateGetStringi(GLenum, GLuint) {
+        return reinterpret_cast<const GLubyte*>("");
+    }
+}
+
+/* GLEW entry points. */
+
+#define OPENGLAPP_MOCK_RECORDED(name) decltype(__glew##name) __glew##name = &Entry<"gl" #name, decltype(__glew##name)>::call;
+#define OPENGLAPP_MOCK_SIMULATED(name, implementation) decltype(__glew##name) __glew##name = &Entry<"gl" #name, decltype(__glew##name), implementation>::call;
+
+OPENGLAPP_MOCK_SIMULATED(CreateShader, &simulateCreateShader)
+OPENGLAPP_MOCK_SIMULATED(DeleteShader, &simulateDeleteShader)
+OPENGLAPP_MOCK_SIMULATED(ShaderSource, &simulateShaderSource)
+OPENGLAPP_MOCK_SIMULATED(CompileShader, &simulateCompileShader)
+OPENGLAPP_MOCK_SIMULATED(GetShaderiv, &simulateGetShaderiv)
+OPENGLAPP_MOCK_SIMULATED(GetShaderInfoLog, &simulateGetShaderInfoLog)
+OPENGLAPP_MOCK_SIMULATED(CreateProgram, &simulateCreateProgram)
+OPENGLAPP_MOCK_SIMULATED(DeleteProgram, &simulateDeleteProgram)
+OPENGLAPP_MOCK_SIMULATED(AttachShader, &simulateAttachShader)
+OPENGLAPP_MOCK_SIMULATED(DetachShader, &simulateDetachShader)
+OPENGLAPP_MOCK_SIMULATED(LinkProgram, &simulateLinkProgram)
+OPENGLAPP_MOCK_SIMULATED(UseProgram, &simulateUseProgram)
+OPENGLAPP_MOCK_SIMULATED(ProgramParameteri, &simulateProgramParameteri)
+OPENGLAPP_MOCK_SIMULATED(GetProgramiv, &simulateGetProgramiv)
+OPENGLAPP_MOCK_SIMULATED(GetProgramInfoLog, &simulateGetProgramInfoLog)
+OPENGLAPP_MOCK_SIMULATED(GetActiveUniform, &simulateGetActiveVariable<&Program::uniforms>)
+OPENGLAPP_MOCK_SIMULATED(GetActiveAttrib, &simulateGetActiveVariable<&Program::attributes>)
+OPENGLAPP_MOCK_SIMULATED(GetUniformLocation, &simulateGetUniformLocation)
+OPENGLAPP_MOCK_SIMULATED(GetAttribLocation, &simulateGetAttribLocation)
+OPENGLAPP_MOCK_SIMULATED(GetUniformBlockIndex, &simulateGetUniformBlockIndex)
+OPENGLAPP_MOCK_SIMULATED(GetActiveUniformBlockName, &simulateGetActiveUniformBlockName)
+OPENGLAPP_MOCK_SIMULATED(GetActiveUniformBlockiv, &simulateGetActiveUniformBlockiv)
+OPENGLAPP_MOCK_SIMULATED(UniformBlockBinding, &simulateUniformBlockBinding)
+OPENGLAPP_MOCK_RECORDED(ValidateProgram)
+OPENGLAPP_MOCK_RECORDED(BindAttribLocation)
+OPENGLAPP_MOCK_RECORDED(BindFragDataLocation)
+OPENGLAPP_MOCK_RECORDED(MaxShaderCompilerThreadsKHR)
+OPENGLAPP_MOCK_RECORDED(MaxShaderCompilerThreadsARB)
+
+OPENGLAPP_MOCK_SIMULATED(Uniform1f, &simulateUniformValues<GLfloat>)
+OPENGLAPP_MOCK_SIMULATED(Uniform2f, (&simulateUniformValues<GLfloat, GLfloat>))
+OPENGLAPP_MOCK_SIMULATED(Uniform3f, (&simulateUniformValues<GLfloat, GLfloat, GLfloat>))
+OPENGLAPP_MOCK_SIMULATED(Uniform4f, (&simulateUniformValues<GLfloat, GLfloat, GLfloat, GLfloat>))
+OPENGLAPP_MOCK_SIMULATED(Uniform1i, &simulateUniformValues<GLint>)
+OPENGLAPP_MOCK_SIMULATED(Uniform2i, (&simulateUniformValues<GLint, GLint>))
+OPENGLAPP_MOCK_SIMULATED(Uniform3i, (&simulateUniformValues<GLint, GLint, GLint>))
+OPENGLAPP_MOCK_SIMULATED(Uniform4i, (&simulateUniformValues<GLint, GLint, GLint, GLint>))
+OPENGLAPP_MOCK_SIMULATED(Uniform1ui, &simulateUniformValues<GLuint>)
+OPENGLAPP_MOCK_SIMULATED(Uniform2ui, (&simulateUniformValues<GLuint, GLuint>))
+OPENGLAPP_MOCK_SIMULATED(Uniform3ui, (&simulateUniformValues<GLuint, GLuint, GLuint>))
+OPENGLAPP_MOCK_SIMULATED(Uniform4ui, (&simulateUniformValues<GLuint, GLuint, GLuint, GLuint>))
+OPENGLAPP_MOCK_SIMULATED(Uniform1fv, (&simulateUniformVector<GLfloat, 1>))
+OPENGLAPP_MOCK_SIMULATED(Uniform2fv, (&simulateUniformVector<GLfloat, 2>))
+OPENGLAPP_MOCK_SIMULATED(Uniform3fv, (&simulateUniformVector<GLfloat, 3>))
+OPENGLAPP_MOCK_SIMULATED(Uniform4fv, (&simulateUniformVector<GLfloat, 4>))
+OPENGLAPP_MOCK_SIMULATED(Uniform1iv, (&simulateUniformVector<GLint, 1>))
+OPENGLAPP_MOCK_SIMULATED(Uniform2iv, (&simulateUniformVector<GLint, 2>))
+OPENGLAPP_MOCK_SIMULATED(Uniform3iv, (&simulateUniformVector<GLint, 3>))
+OPENGLAPP_MOCK_SIMULATED(Uniform4iv, (&simulateUniformVector<GLint, 4>))
+OPENGLAPP_MOCK_SIMULATED(Uniform1uiv, (&simulateUniformVector<GLuint, 1>))
+OPENGLAPP_MOCK_SIMULATED(Uniform2uiv, (&simulateUniformVector<GLuint, 2>))
+OPENGLAPP_MOCK_SIMULATED(Uniform3uiv, (&simulateUniformVector<GLuint, 3>))
+OPENGLAPP_MOCK_SIMULATED(Uniform4uiv, (&simulateUniformVector<GLuint, 4>))
+OPENGLAPP_MOCK_SIMULATED(UniformMatrix2fv, (&simulateUniformMatrix<2, 2>))
+OPENGLAPP_MOCK_SIMULATED(UniformMatrix3fv, (&simulateUniformMatrix<3, 3>))
+OPENGLAPP_MOCK_SIMULATED(UniformMatrix4fv, (&simulateUniformMatrix<4, 4>))
+OPENGLAPP_MOCK_SIMULATED(UniformMatrix2x3fv, (&simulateUniformMatrix<2, 3>))
+OPENGLAPP_MOCK_SIMULATED(UniformMatrix2x4fv, (&simulateUniformMatrix<2, 4>))
+OPENGLAPP_MOCK_SIMULATED(UniformMatrix3x2fv, (&simulateUniformMatrix<3, 2>))
+OPENGLAPP_MOCK_SIMULATED(UniformMatrix3x4fv, (&simulateUniformMatrix<3, 4>))
+OPENGLAPP_MOCK_SIMULATED(UniformMatrix4x2fv, (&simulateUniformMatrix<4, 2>))
+OPENGLAPP_MOCK_SIMULATED(UniformMatrix4x3fv, (&simulateUniformMatrix<4, 3>))
+OPENGLAPP_MOCK_SIMULATED(ProgramUniform1f, &simulateProgramUniformValues<GLfloat>)
+OPENGLAPP_MOCK_SIMULATED(ProgramUniform1i, &simulateProgramUniformValues<GLint>)
+OPENGLAPP_MOCK_SIMULATED(ProgramUniform1ui, &simulateProgramUniformValues<GLuint>)
+OPENGLAPP_MOCK_SIMULATED(ProgramUniform2fv, (&simulateProgramUniformVector<GLfloat, 2>))
+OPENGLAPP_MOCK_SIMULATED(ProgramUniform3fv, (&simulateProgramUniformVector<GLfloat, 3>))
+OPENGLAPP_MOCK_SIMULATED(ProgramUniform4fv, (&simulateProgramUniformVector<GLfloat, 4>))
+OPENGLAPP_MOCK_SIMULATED(ProgramUniform2iv, (&simulateProgramUniformVector<GLint, 2>))
+OPENGLAPP_MOCK_SIMULATED(ProgramUniform3iv, (&simulateProgramUniformVector<GLint, 3>))
+OPENGLAPP_MOCK_SIMULATED(ProgramUniform4iv, (&simulateProgramUniformVector<GLint, 4>))
+OPENGLAPP_MOCK_SIMULATED(ProgramUniform2uiv, (&simulateProgramUniformVector<GLuint, 2>))
+OPENGLAPP_MOCK_SIMULATED(ProgramUniform3uiv, (&simulateProgramUniformVector<GLuint, 3>))
+OPENGLAPP_MOCK_SIMULATED(ProgramUniform4uiv, (&simulateProgramUniformVector<GLuint, 4>))
+OPENGLAPP_MOCK_SIMULATED(ProgramUniformMatrix3fv, (&simulateProgramUniformMatrix<3, 3>))
+OPENGLAPP_MOCK_SIMULATED(ProgramUniformMatrix4fv, (&simulateProgramUniformMatrix<4, 4>))
+OPENGLAPP_MOCK_SIMULATED(GetUniformfv, &loadUniform<GLfloat>)
+OPENGLAPP_MOCK_SIMULATED(GetUniformiv, &loadUniform<GLint>)
+OPENGLAPP_MOCK_SIMULATED(GetUniformuiv, &loadUniform<GLuint>)
+
+OPENGLAPP_MOCK_SIMULATED(GenBuffers, &simulateGenBuffers)
+OPENGLAPP_MOCK_SIMULATED(DeleteBuffers, &simulateDeleteBuffers)
+OPENGLAPP_MOCK_SIMULATED(BindBuffer, &simulateBindBuffer)
+OPENGLAPP_MOCK_SIMULATED(BindBufferBase, &simulateBindBufferBase)
+OPENGLAPP_MOCK_SIMULATED(BindBufferRange, &simulateBindBufferRange)
+OPENGLAPP_MOCK_SIMULATED(BufferData, &simulateBufferData)
+OPENGLAPP_MOCK_SIMULATED(BufferStorage, &simulateBufferStorage)
+OPENGLAPP_MOCK_SIMULATED(BufferSubData, &simulateBufferSubData)
+OPENGLAPP_MOCK_SIMULATED(GetBufferSubData, &simulateGetBufferSubData)
+OPENGLAPP_MOCK_SIMULATED(MapBufferRange, &simulateMapBufferRange)
+OPENGLAPP_MOCK_SIMULATED(UnmapBuffer, &simulateUnmapBuffer)
+OPENGLAPP_MOCK_RECORDED(FlushMappedBufferRange)
+OPENGLAPP_MOCK_SIMULATED(CreateBuffers, &simulateGenBuffers)
+OPENGLAPP_MOCK_SIMULATED(NamedBufferData, &simulateNamedBufferData)
+OPENGLAPP_MOCK_SIMULATED(NamedBufferStorage, &simulateNamedBufferStorage)
+OPENGLAPP_MOCK_SIMULATED(NamedBufferSubData, &simulateNamedBufferSubData)
+OPENGLAPP_MOCK_SIMULATED(MapNamedBufferRange, &simulateMapNamedBufferRange)
+OPENGLAPP_MOCK_SIMULATED(UnmapNamedBuffer, &simulateUnmapNamedBuffer)
+
+OPENGLAPP_MOCK_SIMULATED(GenVertexArrays, &simulateGenNames<&Context::vertex_arrays>)
+OPENGLAPP_MOCK_SIMULATED(DeleteVertexArrays, &simulateDeleteNames<&Context::vertex_arrays>)
+OPENGLAPP_MOCK_RECORDED(BindVertexArray)
+OPENGLAPP_MOCK_RECORDED(VertexAttribPointer)
+OPENGLAPP_MOCK_RECORDED(VertexAttribIPointer)
+OPENGLAPP_MOCK_RECORDED(VertexAttribDivisor)
+OPENGLAPP_MOCK_RECORDED(EnableVertexAttribArray)
+OPENGLAPP_MOCK_RECORDED(DisableVertexAttribArray)
+OPENGLAPP_MOCK_SIMULATED(CreateVertexArrays, &simulateGenNames<&Context::vertex_arrays>)
+
+OPENGLAPP_MOCK_SIMULATED(GenFramebuffers, &simulateGenNames<&Context::framebuffers>)
+OPENGLAPP_MOCK_SIMULATED(DeleteFramebuffers, &simulateDeleteNames<&Context::framebuffers>)
+OPENGLAPP_MOCK_SIMULATED(CheckFramebufferStatus, &simulateCheckFramebufferStatus)
+OPENGLAPP_MOCK_RECORDED(BindFramebuffer)
+OPENGLAPP_MOCK_RECORDED(FramebufferTexture)
+OPENGLAPP_MOCK_RECORDED(FramebufferTexture2D)
+OPENGLAPP_MOCK_RECORDED(FramebufferTextureLayer)
+OPENGLAPP_MOCK_RECORDED(FramebufferRenderbuffer)
+OPENGLAPP_MOCK_RECORDED(BlitFramebuffer)
+OPENGLAPP_MOCK_RECORDED(DrawBuffers)
+OPENGLAPP_MOCK_SIMULATED(CreateFramebuffers, &simulateGenNames<&Context::framebuffers>)
+OPENGLAPP_MOCK_SIMULATED(GenRenderbuffers, &simulateGenNames<&Context::renderbuffers>)
+OPENGLAPP_MOCK_SIMULATED(DeleteRenderbuffers, &simulateDeleteNames<&Context::renderbuffers>)
+OPENGLAPP_MOCK_RECORDED(BindRenderbuffer)
+OPENGLAPP_MOCK_RECORDED(RenderbufferStorage)
+OPENGLAPP_MOCK_RECORDED(RenderbufferStorageMultisample)
+OPENGLAPP_MOCK_SIMULATED(CreateRenderbuffers, &simulateGenNames<&Context::renderbuffers>)
+
+OPENGLAPP_MOCK_SIMULATED(ActiveTexture, &simulateActiveTexture)
+OPENGLAPP_MOCK_RECORDED(TexImage3D)
+OPENGLAPP_MOCK_RECORDED(TexSubImage3D)
+OPENGLAPP_MOCK_RECORDED(TexImage2DMultisample)
+OPENGLAPP_MOCK_RECORDED(TexBuffer)
+OPENGLAPP_MOCK_RECORDED(GenerateMipmap)
+OPENGLAPP_MOCK_RECORDED(TexStorage2D)
+OPENGLAPP_MOCK_SIMULATED(CreateTextures, &simulateCreateNames<&Context::textures>)
+OPENGLAPP_MOCK_RECORDED(TextureStorage2D)
+OPENGLAPP_MOCK_RECORDED(TextureStorage3D)
+OPENGLAPP_MOCK_RECORDED(TextureSubImage2D)
+OPENGLAPP_MOCK_RECORDED(TextureSubImage3D)
+OPENGLAPP_MOCK_RECORDED(TextureParameteri)
+OPENGLAPP_MOCK_RECORDED(GenerateTextureMipmap)
+OPENGLAPP_MOCK_RECORDED(GetTextureHandleARB)
+OPENGLAPP_MOCK_RECORDED(MakeTextureHandleResidentARB)
+OPENGLAPP_MOCK_RECORDED(MakeTextureHandleNonResidentARB)
+
+OPENGLAPP_MOCK_RECORDED(DrawArraysInstanced)
+OPENGLAPP_MOCK_RECORDED(DrawElementsInstanced)
+OPENGLAPP_MOCK_RECORDED(DrawElementsBaseVertex)
+OPENGLAPP_MOCK_RECORDED(DrawRangeElements)
+OPENGLAPP_MOCK_RECORDED(MultiDrawArrays)
+OPENGLAPP_MOCK_RECORDED(MultiDrawElements)
+OPENGLAPP_MOCK_RECORDED(BlendFuncSeparate)
+OPENGLAPP_MOCK_RECORDED(BlendEquation)
+OPENGLAPP_MOCK_RECORDED(ClearBufferfv)
+OPENGLAPP_MOCK_RECORDED(ClearBufferiv)
+
+OPENGLAPP_MOCK_SIMULATED(GenProgramPipelines, &simulateGenNames<&Context::program_pipelines>)
+OPENGLAPP_MOCK_SIMULATED(CreateProgramPipelines, &simulateGenNames<&Context::program_pipelines>)
+OPENGLAPP_MOCK_SIMULATED(DeleteProgramPipelines, &simulateDeleteNames<&Context::program_pipelines>)
+OPENGLAPP_MOCK_RECORDED(BindProgramPipeline)
+OPENGLAPP_MOCK_RECORDED(UseProgramStages)
+
+OPENGLAPP_MOCK_SIMULATED(GenQueries, &simulateGenNames<&Context::queries>)
+OPENGLAPP_MOCK_SIMULATED(DeleteQueries, &simulateDeleteNames<&Context::queries>)
+OPENGLAPP_MOCK_RECORDED(BeginQuery)
+OPENGLAPP_MOCK_RECORDED(EndQuery)
+OPENGLAPP_MOCK_RECORDED(QueryCounter)
+OPENGLAPP_MOCK_SIMULATED(GetQueryObjectiv, &simulateGetQueryObjectiv)
+OPENGLAPP_MOCK_SIMULATED(GetQueryObjectui64v, &simulateGetQueryObjectui64v)
+
+OPENGLAPP_MOCK_SIMULATED(FenceSync, &simulateFenceSync)
+OPENGLAPP_MOCK_SIMULATED(ClientWaitSync, &simulateClientWaitSync)
+OPENGLAPP_MOCK_RECORDED(WaitSync)
+OPENGLAPP_MOCK_RECORDED(DeleteSync)
+
+OPENGLAPP_MOCK_SIMULATED(GetStringi, &simulateGetStringi)
+
+#undef OPENGLAPP_MOCK_RECORDED
+#undef OPENGLAPP_MOCK_SIMULATED
+
+// Core profile 3.3 is simulated, without any extension.
+GLboolean __GLEW_VERSION_1_1 = GL_TRUE, __GLEW_VERSION_1_2 = GL_TRUE, __GLEW_VERSION_1_3 = GL_TRUE, __GLEW_VERSION_1_4 = GL_TRUE,
+    __GLEW_VERSION_1_5 = GL_TRUE, __GLEW_VERSION_2_0 = GL_TRUE, __GLEW_VERSION_2_1 = GL_TRUE, __GLEW_VERSION_3_0 = GL_TRUE,
+    __GLEW_VERSION_3_1 = GL_TRUE, __GLEW_VERSION_3_2 = GL_TRUE, __GLEW_VERSION_3_3 = GL_TRUE, __GLEW_VERSION_4_0 = GL_FALSE,
+    __GLEW_VERSION_4_1 = GL_FALSE, __GLEW_VERSION_4_2 = GL_FALSE, __GLEW_VERSION_4_3 = GL_FALSE, __GLEW_VERSION_4_4 = GL_FALSE,
+    __GLEW_VERSION_4_5 = GL_FALSE, __GLEW_VERSION_4_6 = GL_FALSE;
+GLboolean __GLEW_ARB_parallel_shader_compile = GL_FALSE, __GLEW_KHR_parallel_shader_compile = GL_FALSE;
+GLboolean __GLEW_ARB_bindless_texture = GL_FALSE, __GLEW_ARB_texture_storage = GL_FALSE;
+GLboolean __GLEW_ARB_separate_shader_objects = GL_FALSE, __GLEW_ARB_multi_draw_indirect = GL_FALSE, __GLEW_ARB_buffer_storage = GL_FALSE, __GLEW_ARB_direct_state_access = GL_FALSE;
+
+GLboolean glewExperimental = GL_FALSE;
+
+extern "C" {
+    GLenum GLEWAPIENTRY glewInit() {
+        return GLEW_OK;
+    }
+
+    GLboolean GLEWAPIENTRY glewIsSupported(const char*) {
+        return GL_FALSE;
+    }
+
+    const GLubyte *GLEWAPIENTRY glewGetErrorString(GLenum) {
+        return reinterpret_cast<const GLubyte*>("No error");
+    }
+}
+
+/* GL 1.0/1.1 entry points, which are exported directly by the GL library. */
+
+extern "C" {
+    void APIENTRY glClear(GLbitfield mask) { record("glClear", mask); }
+    void APIENTRY glClearColor(GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha) { record("glClearColor", red, green, blue, alpha); }
+    void APIENTRY glEnable(GLenum capability) { record("glEnable", capability); }
+    void APIENTRY glDisable(GLenum capability) { record("glDisable", capability); }
+    void APIENTRY glViewport(GLint x, GLint y, GLsizei width, GLsizei height) { record("glViewport", x, y, width, height); }
+    void APIENTRY glScissor(GLint x, GLint y, GLsizei width, GLsizei height) { record("glScissor", x, y, width, height); }
+    void APIENTRY glDepthFunc(GLenum func) { record("glDepthFunc", func); }
+    void APIENTRY glDepthMask(GLboolean flag) { record("glDepthMask", flag); }
+    void APIENTRY glBlendFunc(GLenum source_factor, GLenum destination_factor) { record("glBlendFunc", source_factor, destination_factor); }
+    void APIENTRY glCullFace(GLenum mode) { record("glCullFace", mode); }
+    void APIENTRY glFrontFace(GLenum mode) { record("glFrontFace", mode); }
+    void APIENTRY glPolygonMode(GLenum face, GLenum mode) { record("glPolygonMode", face, mode); }
+    void APIENTRY glPixelStorei(GLenum parameter, GLint value) { record("glPixelStorei", parameter, value); }
+    void APIENTRY glReadBuffer(GLenum mode) { record("glReadBuffer", mode); }
+    void APIENTRY glDrawBuffer(GLenum mode) { record("glDrawBuffer", mode); }
+    void APIENTRY glFlush() { record("glFlush"); }
+    void APIENTRY glFinish() { record("glFinish"); }
+    GLenum APIENTRY glGetError() { return GL_NO_ERROR; }
+
+    const GLubyte *APIENTRY glGetString(GLenum name) {
+        record("glGetString", name);
+        switch (name){
+            case GL_VENDOR: return reinterpret_cast<const GLubyte*>("OpenGLApp");
+            case GL_RENDERER: return reinterpret_cast<const GLubyte*>("Mock");
+            case GL_VERSION: return reinterpret_cast<const GLubyte*>("3.3.0 Core Profile Mock");
+            case GL_SHADING_LANGUAGE_VERSION: return reinterpret_cast<const GLubyte*>("3.30");
+            default: return nullptr;
+        }
+    }
+
+    void APIENTRY glGetIntegerv(GLenum parameter, GLint *data) {
+        record("glGetIntegerv", parameter, data);
+        switch (parameter){
+            case GL_MAJOR_VERSION: *data = 3; break;
+            case GL_MINOR_VERSION: *data = 3; break;
+            case GL_CONTEXT_PROFILE_MASK: *data = GL_CONTEXT_CORE_PROFILE_BIT; break;
+            case GL_ACTIVE_TEXTURE: *data = static_cast<GLint>(context.active_texture); break;
+            case GL_CURRENT_PROGRAM: *data = static_cast<GLint>(context.current_program); break;
+            case GL_MAX_TEXTURE_SIZE: *data = 16384; break;
+            case GL_MAX_ARRAY_TEXTURE_LAYERS: *data = 2048; break;
+            case GL_MAX_COMBINED_TEXTURE_IMAGE_UNITS: *data = 32; break;
+            case GL_MAX_TEXTURE_IMAGE_UNITS: *data = 16; break;
+            case GL_MAX_UNIFORM_BUFFER_BINDINGS: *data = 36; break;
+            case GL_MAX_TEXTURE_BUFFER_SIZE: *data = 1 << 27; break;
+            default: *data = 0; break;
+        }
+    }
+
+    void APIENTRY glGetFloatv(GLenum parameter, GLfloat *data) {
+        record("glGetFloatv", parameter, data);
+        *data = 0.f;
+    }
+
+    void APIENTRY glGenTextures(GLsizei n, GLuint *textures) {
+        record("glGenTextures", n, textures);
+        simulateGenNames<&Context::textures>(n, textures);
+    }
+
+    void APIENTRY glDeleteTextures(GLsizei n, const GLuint *textures) {
+        record("glDeleteTextures", n, textures);
+        simulateDeleteNames<&Context::textures>(n, textures);
+    }
+
+    void APIENTRY glBindTexture(GLenum target, GLuint texture) { record("glBindTexture", target, texture); }
+    void APIENTRY glTexParameteri(GLenum target, GLenum parameter, GLint value) { record("glTexParameteri", target, parameter, value); }
+    void APIENTRY glTexParameterf(GLenum target, GLenum parameter, GLfloat value) { record("glTexParameterf", target, parameter, value); }
+    void APIENTRY glTexParameteriv(GLenum target, GLenum parameter, const GLint *values) { record("glTexParameteriv", target, parameter, values); }
+    void APIENTRY glTexParameterfv(GLenum target, GLenum parameter, const GLfloat *values) { record("glTexParameterfv", target, parameter, values); }
+
+    void APIENTRY glTexImage2D(GLenum target, GLint level, GLint internal_format, GLsizei width, GLsizei height, GLint border, GLenum format, GLenum type, const void *pixels) {
+        record("glTexImage2D", target, level, internal_format, width, height, border, format, type, pixels);
+    }
+
+    void APIENTRY glTexSubImage2D(GLenum target, GLint level, GLint x_offset, GLint y_offset, GLsizei width, GLsizei height, GLenum format, GLenum type, const void *pixels) {
+        record("glTexSubImage2D", target, level, x_offset, y_offset, width, height, format, type, pixels);
+    }
+
+    void APIENTRY glReadPixels(GLint x, GLint y, GLsizei width, GLsizei height, GLenum format, GLenum type, void *pixels) {
+        record("glReadPixels", x, y, width, height, format, type, pixels);
+    }
+
+    void APIENTRY glDrawArrays(GLenum mode, GLint first, GLsizei count) { record("glDrawArrays", mode, first, count); }
+    void APIENTRY glDrawElements(GLenum mode, GLsizei count, GLenum type, const void *indices) { record("glDrawElements", mode, count, type, indices); }
+}
+
+std::span<const OpenGL::Mock::Call> OpenGL::Mock::getCalls() noexcept {
+    return context.calls;
+}
+
+std::size_t OpenGL::Mock::countCalls(std::string_view name) noexcept {
+    return std::ranges::count(context.calls, name, &Call::name);
+}
+
+void OpenGL::Mock::clearCalls() noexcept {
+    context.calls.clear();
+}
+
+void OpenGL::Mock::setRecording(bool recording) noexcept {
+    context.recording = recording;
+}
+
+void OpenGL::Mock::reset() {
+    const bool recording = context.recording;
+    context = {};
+    context.recording = recording;
+}
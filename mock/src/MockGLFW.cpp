@@ -0,0 +1,206 @@
+//
+// Created by gomkyung2 on 2026/10/19.
+//
+
+#include "OpenGLApp/Mock.hpp"
+
+#include <array>
+#include <chrono>
+#include <optional>
+
+struct GLFWwindow{
+    int width, height;
+    void *user_pointer = nullptr;
+    bool should_close = false;
+    std::size_t swap_count = 0;
+    std::optional<std::size_t> swap_limit;
+
+    GLFWwindowsizefun window_size_callback = nullptr;
+    GLFWframebuffersizefun framebuffer_size_callback = nullptr;
+    GLFWkeyfun key_callback = nullptr;
+    GLFWmousebuttonfun mouse_button_callback = nullptr;
+    GLFWcursorposfun cursor_pos_callback = nullptr;
+    GLFWscrollfun scroll_callback = nullptr;
+
+    std::array<int, GLFW_KEY_LAST + 1> keys {};
+    std::array<int, GLFW_MOUSE_BUTTON_LAST + 1> mouse_buttons {};
+    double cursor_x = 0.0, cursor_y = 0.0;
+};
+
+namespace{
+    GLFWwindow *current_context = nullptr;
+    std::chrono::steady_clock::time_point init_time = std::chrono::steady_clock::now();
+
+    template <typename Callback>
+    Callback exchangeCallback(Callback &callback, Callback new_callback) {
+        const Callback previous_callback = callback;
+        callback = new_callback;
+        return previous_callback;
+    }
+}
+
+extern "C" {
+    int glfwInit() {
+        init_time = std::chrono::steady_clock::now();
+        return GLFW_TRUE;
+    }
+
+    void glfwTerminate() {
+        current_context = nullptr;
+    }
+
+    void glfwDefaultWindowHints() { }
+    void glfwWindowHint(int, int) { }
+
+    GLFWwindow *glfwCreateWindow(int width, int height, const char*, GLFWmonitor*, GLFWwindow*) {
+        return new GLFWwindow { .width = width, .height = height };
+    }
+
+    void glfwDestroyWindow(GLFWwindow *window) {
+        if (current_context == window){
+            current_context = nullptr;
+        }
+        delete window;
+    }
+
+    void glfwMakeContextCurrent(GLFWwindow *window) {
+        current_context = window;
+    }
+
+    GLFWwindow *glfwGetCurrentContext() {
+        return current_context;
+    }
+
+    void glfwSwapInterval(int) { }
+
+    int glfwExtensionSupported(const char*) {
+        return GLFW_FALSE;
+    }
+
+    GLFWglproc glfwGetProcAddress(const char*) {
+        return nullptr;
+    }
+
+    void glfwGetFramebufferSize(GLFWwindow *window, int *width, int *height) {
+        if (width) *width = window->width;
+        if (height) *height = window->height;
+    }
+
+    void glfwGetWindowSize(GLFWwindow *window, int *width, int *height) {
+        glfwGetFramebufferSize(window, width, height);
+    }
+
+    void glfwSetWindowUserPointer(GLFWwindow *window, void *pointer) {
+        window->user_pointer = pointer;
+    }
+
+    void *glfwGetWindowUserPointer(GLFWwindow *window) {
+        return window->user_pointer;
+    }
+
+    GLFWwindowsizefun glfwSetWindowSizeCallback(GLFWwindow *window, GLFWwindowsizefun callback) {
+        return exchangeCallback(window->window_size_callback, callback);
+    }
+
+    GLFWframebuffersizefun glfwSetFramebufferSizeCallback(GLFWwindow *window, GLFWframebuffersizefun callback) {
+        return exchangeCallback(window->framebuffer_size_callback, callback);
+    }
+
+    GLFWkeyfun glfwSetKeyCallback(GLFWwindow *window, GLFWkeyfun callback) {
+        return exchangeCallback(window->key_callback, callback);
+    }
+
+    GLFWmousebuttonfun glfwSetMouseButtonCallback(GLFWwindow *window, GLFWmousebuttonfun callback) {
+        return exchangeCallback(window->mouse_button_callback, callback);
+    }
+
+    GLFWcursorposfun glfwSetCursorPosCallback(GLFWwindow *window, GLFWcursorposfun callback) {
+        return exchangeCallback(window->cursor_pos_callback, callback);
+    }
+
+    GLFWscrollfun glfwSetScrollCallback(GLFWwindow *window, GLFWscrollfun callback) {
+        return exchangeCallback(window->scroll_callback, callback);
+    }
+
+    int glfwWindowShouldClose(GLFWwindow *window) {
+        return window->should_close || (window->swap_limit && window->swap_count >= *window->swap_limit);
+    }
+
+    void glfwSetWindowShouldClose(GLFWwindow *window, int value) {
+        window->should_close = value;
+    }
+
+    void glfwPollEvents() { }
+
+    void glfwSwapBuffers(GLFWwindow *window) {
+        ++window->swap_count;
+    }
+
+    double glfwGetTime() {
+        return std::chrono::duration<double> { std::chrono::steady_clock::now() - init_time }.count();
+    }
+
+    unsigned long long glfwGetTimerValue() {
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - init_time).count();
+    }
+
+    unsigned long long glfwGetTimerFrequency() {
+        return 1'000'000'000;
+    }
+
+    void glfwGetCursorPos(GLFWwindow *window, double *x, double *y) {
+        if (x) *x = window->cursor_x;
+        if (y) *y = window->cursor_y;
+    }
+
+    int glfwGetKey(GLFWwindow *window, int key) {
+        return window->keys[key];
+    }
+
+    int glfwGetMouseButton(GLFWwindow *window, int button) {
+        return window->mouse_buttons[button];
+    }
+}
+
+void OpenGL::Mock::setSwapLimit(GLFWwindow *window, std::size_t swap_count) noexcept {
+    window->swap_limit = window->swap_count + swap_count;
+}
+
+void OpenGL::Mock::sendKey(GLFWwindow *window, int key, int action, int mods) {
+    window->keys[key] = action == GLFW_RELEASE ? GLFW_RELEASE : GLFW_PRESS;
+    if (window->key_callback){
+        window->key_callback(window, key, 0, action, mods);
+    }
+}
+
+void OpenGL::Mock::sendMouseButton(GLFWwindow *window, int button, int action, int mods) {
+    window->mouse_buttons[button] = action;
+    if (window->mouse_button_callback){
+        window->mouse_button_callback(window, button, action, mods);
+    }
+}
+
+void OpenGL::Mock::sendCursorPos(GLFWwindow *window, double x, double y) {
+    window->cursor_x = x;
+    window->cursor_y = y;
+    if (window->cursor_pos_callback){
+        window->cursor_pos_callback(window, x, y);
+    }
+}
+
+void OpenGL::Mock::sendScroll(GLFWwindow *window, double x_offset, double y_offset) {
+    if (window->scroll_callback){
+        window->scroll_callback(window, x_offset, y_offset);
+    }
+}
+
+void OpenGL::Mock::sendFramebufferSize(GLFWwindow *window, int width, int height) {
+    window->width = width;
+    window->height = height;
+    if (window->window_size_callback){
+        window->window_size_callback(window, width, height);
+    }
+    if (window->framebuffer_size_callback){
+        window->framebuffer_size_callback(window, width, height);
+    }
+}
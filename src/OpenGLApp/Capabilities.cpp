@@ -0,0 +1,37 @@
+//
+// Created by gomkyung2 on 2026/10/19.
+//
+
+#include "OpenGLApp/Capabilities.hpp"
+
+namespace{
+    OpenGL::Capabilities capabilities;
+}
+
+bool OpenGL::Capabilities::isVersionAtLeast(int major, int minor) const noexcept {
+    return major_version > major || (major_version == major && minor_version >= minor);
+}
+
+void OpenGL::Capabilities::detect() {
+    Capabilities detected;
+    glGetIntegerv(GL_MAJOR_VERSION, &detected.major_version);
+    glGetIntegerv(GL_MINOR_VERSION, &detected.minor_version);
+
+    GLint profile_mask = 0;
+    if (detected.isVersionAtLeast(3, 2)){
+        glGetIntegerv(GL_CONTEXT_PROFILE_MASK, &profile_mask);
+    }
+    detected.core_profile = (profile_mask & GL_CONTEXT_CORE_PROFILE_BIT) != 0;
+
+    detected.separate_shader_objects = detected.isVersionAtLeast(4, 1) || GLEW_ARB_separate_shader_objects;
+    detected.texture_storage = detected.isVersionAtLeast(4, 2) || GLEW_ARB_texture_storage;
+    detected.multi_draw_indirect = detected.isVersionAtLeast(4, 3) || GLEW_ARB_multi_draw_indirect;
+    detected.buffer_storage = detected.isVersionAtLeast(4, 4) || GLEW_ARB_buffer_storage;
+    detected.direct_state_access = detected.isVersionAtLeast(4, 5) || GLEW_ARB_direct_state_access;
+
+    capabilities = detected;
+}
+
+const OpenGL::Capabilities &OpenGL::Capabilities::get() noexcept {
+    return capabilities;
+}
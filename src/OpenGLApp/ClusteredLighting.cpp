@@ -0,0 +1,226 @@
+//
+// Created by gomkyung2 on 2026/10/19.
+//
+
+#include "OpenGLApp/ClusteredLighting.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <cmath>
+
+#include <glm/ext/vector_float4.hpp>
+
+#include "OpenGLApp/Capabilities.hpp"
+#include "OpenGLApp/GLInterceptCore.hpp"
+
+#if defined(__SSE__) || defined(_M_X64)
+#define OPENGLAPP_CLUSTERED_LIGHTING_SSE
+#include <xmmintrin.h>
+#endif
+
+static_assert(sizeof(OpenGL::ClusteredLighting::PointLight) == 4 * sizeof(glm::vec4), "PointLight must be 4 RGBA32F texels.");
+
+namespace{
+    // Lights overlapping a depth slice, in structure of arrays padded to a multiple of 4.
+    struct SliceLights{
+        std::vector<float> x, y, depth, squared_radius;
+        std::vector<GLuint> indices;
+
+        void push(float x_, float y_, float depth_, float squared_radius_, GLuint index){
+            x.push_back(x_);
+            y.push_back(y_);
+            depth.push_back(depth_);
+            squared_radius.push_back(squared_radius_);
+            indices.push_back(index);
+        }
+
+        void pad(){
+            // Negative radius never passes the test.
+            while (x.size() % 4 != 0){
+                push(0.f, 0.f, 0.f, -1.f, 0);
+            }
+        }
+    };
+
+    struct ClusterBounds{
+        glm::vec3 min, max; // (view x, view y, depth).
+    };
+
+    void appendOverlappingLights(const SliceLights &lights, const ClusterBounds &bounds, std::vector<GLuint> &output){
+#ifdef OPENGLAPP_CLUSTERED_LIGHTING_SSE
+        const __m128 zero = _mm_setzero_ps();
+        const __m128 min_x = _mm_set1_ps(bounds.min.x), max_x = _mm_set1_ps(bounds.max.x);
+        const __m128 min_y = _mm_set1_ps(bounds.min.y), max_y = _mm_set1_ps(bounds.max.y);
+        const __m128 min_depth = _mm_set1_ps(bounds.min.z), max_depth = _mm_set1_ps(bounds.max.z);
+        for (std::size_t index = 0; index < lights.x.size(); index += 4){
+            // Squared distance from the sphere center to the nearest point of the AABB.
+            const auto axis_distance = [&](const float *centers, __m128 min, __m128 max){
+                const __m128 center = _mm_loadu_ps(centers + index);
+                const __m128 distance = _mm_add_ps(_mm_max_ps(_mm_sub_ps(min, center), zero), _mm_max_ps(_mm_sub_ps(center, max), zero));
+                return _mm_mul_ps(distance, distance);
+            };
+            const __m128 squared_distance = _mm_add_ps(_mm_add_ps(
+                axis_distance(lights.x.data(), min_x, max_x),
+                axis_distance(lights.y.data(), min_y, max_y)),
+                axis_distance(lights.depth.data(), min_depth, max_depth));
+
+            for (int mask = _mm_movemask_ps(_mm_cmple_ps(squared_distance, _mm_loadu_ps(lights.squared_radius.data() + index))); mask != 0; mask &= mask - 1){
+                output.push_back(lights.indices[index + static_cast<std::size_t>(std::countr_zero(static_cast<unsigned int>(mask)))]);
+            }
+        }
+#else
+        for (std::size_t index = 0; index < lights.x.size(); ++index){
+            const auto axis_distance = [](float center, float min, float max){
+                const float distance = std::fmax(min - center, 0.f) + std::fmax(center - max, 0.f);
+                return distance * distance;
+            };
+            const float squared_distance = axis_distance(lights.x[index], bounds.min.x, bounds.max.x)
+                + axis_distance(lights.y[index], bounds.min.y, bounds.max.y)
+                + axis_distance(lights.depth[index], bounds.min.z, bounds.max.z);
+            if (squared_distance <= lights.squared_radius[index]){
+                output.push_back(lights.indices[index]);
+            }
+        }
+#endif
+    }
+
+    void uploadBuffer(GLuint buffer, const void *data, std::size_t size){
+        // Orphan the previous storage, so that the frames in flight are not waited for.
+        if (OpenGL::Capabilities::get().direct_state_access){
+            glNamedBufferData(buffer, static_cast<GLsizeiptr>(size), nullptr, GL_STREAM_DRAW);
+            if (size != 0){
+                glNamedBufferSubData(buffer, 0, static_cast<GLsizeiptr>(size), data);
+            }
+            return;
+        }
+
+        glBindBuffer(GL_TEXTURE_BUFFER, buffer);
+        glBufferData(GL_TEXTURE_BUFFER, static_cast<GLsizeiptr>(size), nullptr, GL_STREAM_DRAW);
+        if (size != 0){
+            glBufferSubData(GL_TEXTURE_BUFFER, 0, static_cast<GLsizeiptr>(size), data);
+        }
+    }
+}
+
+OpenGL::ClusteredLighting::ClusteredLighting(glm::uvec3 grid_size)
+        : grid_size { grid_size },
+          grid(static_cast<std::size_t>(grid_size.x) * grid_size.y * grid_size.z),
+          slice_indices(grid_size.z)
+{
+    const auto attach = [](const Buffer &buffer, const Texture &texture, GLenum internal_format){
+        uploadBuffer(buffer.getHandle(), nullptr, 0);
+        glBindTexture(GL_TEXTURE_BUFFER, texture.getHandle());
+        glTexBuffer(GL_TEXTURE_BUFFER, internal_format, buffer.getHandle());
+    };
+    attach(light_buffer, light_texture, GL_RGBA32F);
+    attach(grid_buffer, grid_texture, GL_RG32UI);
+    attach(index_buffer, index_texture, GL_R32UI);
+}
+
+void OpenGL::ClusteredLighting::update(std::span<const PointLight> lights, const glm::mat4 &view, const PerspectiveProjection &projection,
+                                       glm::ivec2 framebuffer_size, Utils::ThreadPool &thread_pool) {
+    if (framebuffer_size.x <= 0 || framebuffer_size.y <= 0){
+        // Minimized window: nothing is drawn, so keep the previous grid.
+        return;
+    }
+
+    const float near = projection.near_distance, far = projection.far_distance;
+    const float log_depth_ratio = std::log(far / near);
+    const float tan_half_fov_y = std::tan(projection.fov / 2);
+    const float tan_half_fov_x = tan_half_fov_y * static_cast<float>(framebuffer_size.x) / static_cast<float>(framebuffer_size.y);
+
+    tile_size = glm::vec2 { framebuffer_size } / glm::vec2 { grid_size.x, grid_size.y };
+    depth_params = { near, far, static_cast<float>(grid_size.z) / log_depth_ratio, -static_cast<float>(grid_size.z) * std::log(near) / log_depth_ratio };
+
+    // Light centers in view space, with the depth (-z) instead of z.
+    std::vector<glm::vec4> view_lights;
+    view_lights.reserve(lights.size());
+    for (const PointLight &light : lights){
+        const glm::vec4 position = view * glm::vec4 { light.position, 1.f };
+        view_lights.emplace_back(position.x, position.y, -position.z, light.radius);
+    }
+
+    thread_pool.parallelFor(grid_size.z, [&](std::size_t slice){
+        const float slice_near = near * std::exp(log_depth_ratio * static_cast<float>(slice) / static_cast<float>(grid_size.z));
+        const float slice_far = near * std::exp(log_depth_ratio * static_cast<float>(slice + 1) / static_cast<float>(grid_size.z));
+
+        SliceLights slice_lights;
+        for (std::size_t index = 0; index < view_lights.size(); ++index){
+            const glm::vec4 &light = view_lights[index];
+            if (light.z + light.w >= slice_near && light.z - light.w <= slice_far){
+                slice_lights.push(light.x, light.y, light.z, light.w * light.w, static_cast<GLuint>(index));
+            }
+        }
+        slice_lights.pad();
+
+        std::vector<GLuint> &output = slice_indices[slice];
+        output.clear();
+        for (unsigned int y = 0; y < grid_size.y; ++y){
+            // Tile edges in NDC, scaled by the depth to get the view space extent.
+            const float ndc_y0 = 2.f * static_cast<float>(y) / static_cast<float>(grid_size.y) - 1.f;
+            const float ndc_y1 = 2.f * static_cast<float>(y + 1) / static_cast<float>(grid_size.y) - 1.f;
+            for (unsigned int x = 0; x < grid_size.x; ++x){
+                const float ndc_x0 = 2.f * static_cast<float>(x) / static_cast<float>(grid_size.x) - 1.f;
+                const float ndc_x1 = 2.f * static_cast<float>(x + 1) / static_cast<float>(grid_size.x) - 1.f;
+                const ClusterBounds bounds {
+                    { std::fmin(ndc_x0 * slice_near, ndc_x0 * slice_far) * tan_half_fov_x, std::fmin(ndc_y0 * slice_near, ndc_y0 * slice_far) * tan_half_fov_y, slice_near },
+                    { std::fmax(ndc_x1 * slice_near, ndc_x1 * slice_far) * tan_half_fov_x, std::fmax(ndc_y1 * slice_near, ndc_y1 * slice_far) * tan_half_fov_y, slice_far },
+                };
+
+                // Offset is relative to the slice until the slices are concatenated.
+                const auto offset = static_cast<GLuint>(output.size());
+                appendOverlappingLights(slice_lights, bounds, output);
+                grid[(slice * grid_size.y + y) * grid_size.x + x] = { offset, static_cast<GLuint>(output.size()) - offset };
+            }
+        }
+    });
+
+    // Concatenate the slices.
+    indices.clear();
+    const std::size_t clusters_per_slice = static_cast<std::size_t>(grid_size.x) * grid_size.y;
+    for (std::size_t slice = 0; slice < grid_size.z; ++slice){
+        const auto base = static_cast<GLuint>(indices.size());
+        for (std::size_t cluster = slice * clusters_per_slice; cluster < (slice + 1) * clusters_per_slice; ++cluster){
+            grid[cluster].x += base;
+        }
+        indices.insert(indices.end(), slice_indices[slice].begin(), slice_indices[slice].end());
+    }
+
+    uploadBuffer(light_buffer.getHandle(), lights.data(), lights.size_bytes());
+    uploadBuffer(grid_buffer.getHandle(), grid.data(), grid.size() * sizeof(glm::uvec2));
+    uploadBuffer(index_buffer.getHandle(), indices.data(), indices.size() * sizeof(GLuint));
+    if (!Capabilities::get().direct_state_access){
+        glBindBuffer(GL_TEXTURE_BUFFER, 0);
+    }
+
+    statistics.light_count = lights.size();
+    statistics.index_count = indices.size();
+    statistics.max_lights_per_cluster = std::ranges::max(grid, {}, [](const glm::uvec2 &cluster) { return cluster.y; }).y;
+    statistics.empty_cluster_count = static_cast<std::size_t>(std::ranges::count_if(grid, [](const glm::uvec2 &cluster) { return cluster.y == 0; }));
+}
+
+void OpenGL::ClusteredLighting::update(std::span<const PointLight> lights, const PerspectiveCamera &camera, glm::ivec2 framebuffer_size, Utils::ThreadPool &thread_pool) {
+    update(lights, camera.view.getMatrix(), camera.projection, framebuffer_size, thread_pool);
+}
+
+void OpenGL::ClusteredLighting::bind(GLuint first_texture_unit) const {
+    glActiveTexture(GL_TEXTURE0 + first_texture_unit);
+    glBindTexture(GL_TEXTURE_BUFFER, light_texture.getHandle());
+    glActiveTexture(GL_TEXTURE0 + first_texture_unit + 1);
+    glBindTexture(GL_TEXTURE_BUFFER, grid_texture.getHandle());
+    glActiveTexture(GL_TEXTURE0 + first_texture_unit + 2);
+    glBindTexture(GL_TEXTURE_BUFFER, index_texture.getHandle());
+}
+
+void OpenGL::ClusteredLighting::setUniforms(const Program &program, GLuint first_texture_unit) const {
+    program.setUniform("cluster_lights", static_cast<int>(first_texture_unit));
+    program.setUniform("cluster_grid", static_cast<int>(first_texture_unit + 1));
+    program.setUniform("cluster_light_indices", static_cast<int>(first_texture_unit + 2));
+    program.setUniform("cluster_grid_size", grid_size);
+    program.setUniform("cluster_tile_size", tile_size);
+    program.setUniform("cluster_depth_params", depth_params);
+}
+
+const OpenGL::ClusteredLighting::Statistics &OpenGL::ClusteredLighting::getStatistics() const noexcept {
+    return statistics;
+}
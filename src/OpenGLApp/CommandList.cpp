@@ -0,0 +1,107 @@
+//
+// Created by gomkyung2 on 2026/10/19.
+//
+
+#include "OpenGLApp/CommandList.hpp"
+
+#include "OpenGLApp/GLInterceptCore.hpp"
+
+void OpenGL::CommandList::UseProgramCommand::run() const {
+    State::setProgram(program);
+}
+
+void OpenGL::CommandList::BindVertexArrayCommand::run() const {
+    glBindVertexArray(vertex_array);
+}
+
+void OpenGL::CommandList::BindTextureCommand::run() const {
+    glActiveTexture(GL_TEXTURE0 + unit);
+    glBindTexture(target, texture);
+}
+
+void OpenGL::CommandList::BindBufferBaseCommand::run() const {
+    glBindBufferBase(target, index, buffer);
+}
+
+void OpenGL::CommandList::DrawArraysCommand::run() const {
+    if (instance_count == 1){
+        glDrawArrays(mode, first, count);
+    }
+    else{
+        glDrawArraysInstanced(mode, first, count, instance_count);
+    }
+}
+
+void OpenGL::CommandList::DrawElementsCommand::run() const {
+    const auto *indices = reinterpret_cast<const void*>(offset);
+    if (instance_count == 1){
+        glDrawElements(mode, count, type, indices);
+    }
+    else{
+        glDrawElementsInstanced(mode, count, type, indices, instance_count);
+    }
+}
+
+OpenGL::CommandList::CommandList(CommandList &&source) noexcept
+        : allocator { std::move(source.allocator) },
+          head { std::exchange(source.head, nullptr) },
+          tail { std::exchange(source.tail, nullptr) },
+          command_count { std::exchange(source.command_count, 0) } {
+
+}
+
+OpenGL::CommandList &OpenGL::CommandList::operator=(CommandList &&source) noexcept {
+    allocator = std::move(source.allocator);
+    head = std::exchange(source.head, nullptr);
+    tail = std::exchange(source.tail, nullptr);
+    command_count = std::exchange(source.command_count, 0);
+    return *this;
+}
+
+void OpenGL::CommandList::useProgram(GLuint program) {
+    append(UseProgramCommand { {}, program });
+}
+
+void OpenGL::CommandList::useProgram(const Program &program) {
+    useProgram(program.getHandle());
+}
+
+void OpenGL::CommandList::bindVertexArray(GLuint vertex_array) {
+    append(BindVertexArrayCommand { {}, vertex_array });
+}
+
+void OpenGL::CommandList::bindTexture(GLuint unit, GLenum target, GLuint texture) {
+    append(BindTextureCommand { {}, unit, target, texture });
+}
+
+void OpenGL::CommandList::bindBufferBase(GLenum target, GLuint index, GLuint buffer) {
+    append(BindBufferBaseCommand { {}, target, index, buffer });
+}
+
+void OpenGL::CommandList::drawArrays(GLenum mode, GLint first, GLsizei count, GLsizei instance_count) {
+    append(DrawArraysCommand { {}, mode, first, count, instance_count });
+}
+
+void OpenGL::CommandList::drawElements(GLenum mode, GLsizei count, GLenum type, std::uintptr_t offset, GLsizei instance_count) {
+    append(DrawElementsCommand { {}, mode, count, type, offset, instance_count });
+}
+
+void OpenGL::CommandList::execute() const {
+    for (const Command *command = head; command; command = command->next){
+        command->execute(*command);
+    }
+}
+
+void OpenGL::CommandList::clear() noexcept {
+    allocator.reset();
+    head = tail = nullptr;
+    command_count = 0;
+}
+
+std::size_t OpenGL::CommandList::size() const noexcept {
+    return command_count;
+}
+
+bool OpenGL::CommandList::empty() const noexcept {
+    return command_count == 0;
+}
@@ -0,0 +1,166 @@
+//
+// Created by gomkyung2 on 2026/10/19.
+//
+
+#include "OpenGLApp/FrameCapture.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+
+#include "OpenGLApp/Capabilities.hpp"
+
+#define STB_IMAGE_WRITE_IMPLEMENTATION
+#include "stb_image_write.h"
+
+void OpenGL::FrameCapture::complete(Slot &slot) {
+    glClientWaitSync(slot.fence, GL_SYNC_FLUSH_COMMANDS_BIT, GL_TIMEOUT_IGNORED);
+    glDeleteSync(slot.fence);
+    slot.fence = nullptr;
+
+    // Pixels are left empty if the buffer cannot be mapped, so that the callback can tell the failure.
+    Frame frame { slot.size.x, slot.size.y, {} };
+    const std::size_t row_bytes = static_cast<std::size_t>(slot.size.x) * 4;
+    const auto byte_count = static_cast<GLsizeiptr>(row_bytes * slot.size.y);
+
+    const auto copy_rows = [&](const unsigned char *mapped){
+        frame.pixels.resize(static_cast<std::size_t>(byte_count));
+        // GL rows start from the bottom.
+        for (int row = 0; row < slot.size.y; ++row){
+            std::memcpy(frame.pixels.data() + row * row_bytes, mapped + (slot.size.y - 1 - row) * row_bytes, row_bytes);
+        }
+    };
+    if (Capabilities::get().direct_state_access){
+        if (const auto *mapped = static_cast<const unsigned char*>(glMapNamedBufferRange(slot.buffer, 0, byte_count, GL_MAP_READ_BIT))){
+            copy_rows(mapped);
+            glUnmapNamedBuffer(slot.buffer);
+        }
+    }
+    else{
+        glBindBuffer(GL_PIXEL_PACK_BUFFER, slot.buffer);
+        if (const auto *mapped = static_cast<const unsigned char*>(glMapBufferRange(GL_PIXEL_PACK_BUFFER, 0, byte_count, GL_MAP_READ_BIT))){
+            copy_rows(mapped);
+            glUnmapBuffer(GL_PIXEL_PACK_BUFFER);
+        }
+        glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+    }
+
+    std::scoped_lock lock { mutex };
+    tasks.emplace_back([callback = std::move(slot.callback), frame = std::move(frame)]() mutable {
+        callback(std::move(frame));
+    });
+    condition.notify_one();
+}
+
+void OpenGL::FrameCapture::workerMain(std::stop_token stop_token) {
+    // Remaining tasks are run even after the stop is requested, since the predicate is checked first.
+    while (true){
+        std::function<void()> task;
+        {
+            std::unique_lock lock { mutex };
+            if (!condition.wait(lock, stop_token, [this] { return !tasks.empty(); })){
+                return;
+            }
+
+            task = std::move(tasks.front());
+            tasks.pop_front();
+        }
+        task();
+    }
+}
+
+OpenGL::FrameCapture::FrameCapture(std::size_t ring_size) : slots(ring_size) {
+    for (Slot &slot : slots){
+        glGenBuffers(1, &slot.buffer);
+    }
+
+    worker = std::jthread { [this](std::stop_token stop_token) { workerMain(std::move(stop_token)); } };
+}
+
+OpenGL::FrameCapture::~FrameCapture() noexcept {
+    flush();
+    for (const Slot &slot : slots){
+        glDeleteBuffers(1, &slot.buffer);
+    }
+}
+
+void OpenGL::FrameCapture::capture(GLuint framebuffer, GLenum read_buffer, glm::ivec2 size, Callback callback) {
+    // All slots are in flight: wait for the oldest one.
+    Slot &slot = slots[next_slot];
+    if (slot.fence){
+        complete(slot);
+    }
+    next_slot = (next_slot + 1) % slots.size();
+
+    GLint previous_framebuffer, previous_read_buffer;
+    glGetIntegerv(GL_READ_FRAMEBUFFER_BINDING, &previous_framebuffer);
+    glGetIntegerv(GL_READ_BUFFER, &previous_read_buffer);
+
+    glBindFramebuffer(GL_READ_FRAMEBUFFER, framebuffer);
+    glReadBuffer(read_buffer);
+
+    // Orphan the previous storage, then read into the buffer. Rows of RGBA8 pixels are aligned for any of the usual
+    // GL_PACK_ALIGNMENT values.
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, slot.buffer);
+    glBufferData(GL_PIXEL_PACK_BUFFER, static_cast<GLsizeiptr>(size.x) * size.y * 4, nullptr, GL_STREAM_READ);
+    glReadPixels(0, 0, size.x, size.y, GL_RGBA, GL_UNSIGNED_BYTE, nullptr);
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+
+    slot.fence = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+    slot.size = size;
+    slot.callback = std::move(callback);
+
+    glBindFramebuffer(GL_READ_FRAMEBUFFER, static_cast<GLuint>(previous_framebuffer));
+    glReadBuffer(static_cast<GLenum>(previous_read_buffer));
+}
+
+void OpenGL::FrameCapture::captureToFile(GLuint framebuffer, GLenum read_buffer, glm::ivec2 size, std::filesystem::path filename) {
+    capture(framebuffer, read_buffer, size, [filename = std::move(filename)](Frame &&frame){
+        writeFile(frame, filename);
+    });
+}
+
+void OpenGL::FrameCapture::poll() {
+    // Complete in the capture order, so that the callbacks are called in the order.
+    for (std::size_t offset = 0; offset < slots.size(); ++offset){
+        Slot &slot = slots[(next_slot + offset) % slots.size()];
+        if (!slot.fence){
+            continue;
+        }
+
+        if (const GLenum result = glClientWaitSync(slot.fence, 0, 0); result != GL_ALREADY_SIGNALED && result != GL_CONDITION_SATISFIED){
+            return;
+        }
+        complete(slot);
+    }
+}
+
+void OpenGL::FrameCapture::flush() {
+    for (std::size_t offset = 0; offset < slots.size(); ++offset){
+        if (Slot &slot = slots[(next_slot + offset) % slots.size()]; slot.fence){
+            complete(slot);
+        }
+    }
+}
+
+bool OpenGL::FrameCapture::Frame::isValid() const noexcept {
+    return !pixels.empty();
+}
+
+std::size_t OpenGL::FrameCapture::getPendingCount() const noexcept {
+    return static_cast<std::size_t>(std::ranges::count_if(slots, [](const Slot &slot) { return slot.fence != nullptr; }));
+}
+
+bool OpenGL::FrameCapture::writeFile(const Frame &frame, const std::filesystem::path &filename) {
+    if (!frame.isValid()){
+        return false;
+    }
+
+    if (filename.extension() == ".png"){
+        return stbi_write_png(filename.string().c_str(), frame.width, frame.height, 4, frame.pixels.data(), frame.width * 4) != 0;
+    }
+
+    std::ofstream file { filename, std::ios::binary };
+    file.write(reinterpret_cast<const char*>(frame.pixels.data()), static_cast<std::streamsize>(frame.pixels.size()));
+    return static_cast<bool>(file);
+}
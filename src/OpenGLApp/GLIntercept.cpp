@@ -0,0 +1,547 @@
+//
+// Created by gomkyung2 on 2026/10/19.
+//
+
+#include "OpenGLApp/GLIntercept.hpp"
+
+#define OPENGLAPP_GL_INTERCEPT_NO_MACROS
+#include "OpenGLApp/GLInterceptCore.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <map>
+#include <optional>
+#include <span>
+#include <unordered_map>
+
+#define OPENGLAPP_DEFINE_CORE_ENTRY(name) decltype(&::gl##name) OpenGL::GLIntercept::core::name = &::gl##name;
+OPENGLAPP_GL_INTERCEPT_CORE_ENTRIES(OPENGLAPP_DEFINE_CORE_ENTRY)
+#undef OPENGLAPP_DEFINE_CORE_ENTRY
+
+// Entry points called through GLEW function pointers (__glew<name>).
+#define OPENGLAPP_GL_INTERCEPT_GLEW_ENTRIES(X) \
+    X(UseProgram) X(LinkProgram) X(DeleteProgram) \
+    X(BindBuffer) X(BindBufferBase) X(BindBufferRange) X(BindVertexArray) X(BindFramebuffer) X(BindRenderbuffer) \
+    X(ActiveTexture) \
+    X(GenBuffers) X(DeleteBuffers) X(GenVertexArrays) X(DeleteVertexArrays) X(GenFramebuffers) X(DeleteFramebuffers) \
+    X(GenRenderbuffers) X(DeleteRenderbuffers) \
+    X(CreateBuffers) X(CreateVertexArrays) X(CreateFramebuffers) X(CreateRenderbuffers) X(CreateTextures) \
+    X(CreateProgramPipelines) \
+    X(BufferData) X(BufferSubData) X(BufferStorage) X(TexImage3D) X(TexSubImage3D) X(TexStorage2D) X(GenerateMipmap) \
+    X(NamedBufferData) X(NamedBufferSubData) X(NamedBufferStorage) \
+    X(TextureStorage2D) X(TextureStorage3D) X(TextureSubImage2D) X(TextureSubImage3D) X(TextureParameteri) \
+    X(GenerateTextureMipmap) \
+    X(VertexAttribPointer) X(EnableVertexAttribArray) X(FramebufferTexture2D) X(FramebufferRenderbuffer) \
+    X(RenderbufferStorage) X(UniformBlockBinding) \
+    X(DrawArraysInstanced) X(DrawElementsInstanced) X(DrawElementsBaseVertex) X(DrawRangeElements) \
+    X(MultiDrawArrays) X(MultiDrawElements) \
+    X(Uniform1i) X(Uniform1ui) X(Uniform1f) \
+    X(Uniform1iv) X(Uniform2iv) X(Uniform3iv) X(Uniform4iv) \
+    X(Uniform1uiv) X(Uniform2uiv) X(Uniform3uiv) X(Uniform4uiv) \
+    X(Uniform1fv) X(Uniform2fv) X(Uniform3fv) X(Uniform4fv) \
+    X(UniformMatrix2fv) X(UniformMatrix3fv) X(UniformMatrix4fv) \
+    X(ProgramUniform1i) X(ProgramUniform1ui) X(ProgramUniform1f) \
+    X(ProgramUniform2iv) X(ProgramUniform3iv) X(ProgramUniform4iv) \
+    X(ProgramUniform2uiv) X(ProgramUniform3uiv) X(ProgramUniform4uiv) \
+    X(ProgramUniform2fv) X(ProgramUniform3fv) X(ProgramUniform4fv) \
+    X(ProgramUniformMatrix3fv) X(ProgramUniformMatrix4fv)
+
+namespace {
+    enum class Entry : std::size_t {
+#define OPENGLAPP_ENUMERATE_ENTRY(name) name,
+        OPENGLAPP_GL_INTERCEPT_GLEW_ENTRIES(OPENGLAPP_ENUMERATE_ENTRY)
+        OPENGLAPP_GL_INTERCEPT_CORE_ENTRIES(OPENGLAPP_ENUMERATE_ENTRY)
+#undef OPENGLAPP_ENUMERATE_ENTRY
+        Count
+    };
+
+    constexpr std::size_t entry_count = static_cast<std::size_t>(Entry::Count);
+
+    constexpr std::array<std::string_view, entry_count> entry_names {
+#define OPENGLAPP_NAME_ENTRY(name) "gl" #name,
+        OPENGLAPP_GL_INTERCEPT_GLEW_ENTRIES(OPENGLAPP_NAME_ENTRY)
+        OPENGLAPP_GL_INTERCEPT_CORE_ENTRIES(OPENGLAPP_NAME_ENTRY)
+#undef OPENGLAPP_NAME_ENTRY
+    };
+
+    struct Counters{
+        std::array<std::size_t, entry_count> calls {};
+        std::size_t draw_calls = 0;
+        std::size_t state_changes = 0;
+        std::size_t redundant_binds = 0;
+        std::size_t uniform_sets = 0;
+        std::size_t redundant_uniform_sets = 0;
+        std::size_t buffer_upload_bytes = 0;
+        std::size_t texture_upload_bytes = 0;
+    };
+
+    // Bindings known since enable(). std::nullopt (or absence in the maps) means unknown.
+    struct Bindings{
+        std::optional<GLuint> program, vertex_array, read_framebuffer, draw_framebuffer, renderbuffer;
+        std::unordered_map<GLenum, GLuint> buffers; // target -> buffer.
+        std::map<std::pair<GLenum, GLuint>, GLuint> indexed_buffers; // (target, index) -> buffer, by glBindBufferBase.
+        GLenum active_texture = GL_TEXTURE0;
+        std::map<std::pair<GLenum, GLenum>, GLuint> textures; // (unit, target) -> texture.
+        std::unordered_map<std::uint64_t, std::vector<std::byte>> uniform_values; // (program, location) -> value bytes.
+    };
+
+    bool enabled = false;
+    Counters counters;
+    Bindings bindings;
+    OpenGL::GLIntercept::FrameStatistics frame_statistics;
+
+    void bind(std::optional<GLuint> &binding, GLuint name){
+        if (binding == name){
+            ++counters.redundant_binds;
+        }
+        else{
+            binding = name;
+            ++counters.state_changes;
+        }
+    }
+
+    template <typename Key>
+    void bind(auto &binding_map, const Key &key, GLuint name){
+        auto [it, inserted] = binding_map.try_emplace(key, name);
+        if (!inserted && it->second == name){
+            ++counters.redundant_binds;
+        }
+        else{
+            it->second = name;
+            ++counters.state_changes;
+        }
+    }
+
+    // Reset the bindings to the deleted objects, as GL does when a bound object is deleted.
+    void unbind(std::optional<GLuint> &binding, std::span<const GLuint> names){
+        if (binding && std::ranges::find(names, *binding) != names.end()){
+            binding = 0;
+        }
+    }
+
+    void unbind(auto &binding_map, std::span<const GLuint> names){
+        for (auto &[key, name] : binding_map){
+            if (std::ranges::find(names, name) != names.end()){
+                name = 0;
+            }
+        }
+    }
+
+    void forgetUniformValues(GLuint program){
+        std::erase_if(bindings.uniform_values, [=](const auto &pair){
+            return static_cast<GLuint>(pair.first >> 32) == program;
+        });
+    }
+
+    // program is the program in use for glUniform*, or the given one for glProgramUniform*.
+    void setUniform(std::optional<GLuint> program, GLint location, const void *value, std::size_t size){
+        ++counters.uniform_sets;
+        if (location == -1){
+            // Silently ignored by GL, but still a wasted call.
+            ++counters.redundant_uniform_sets;
+            return;
+        }
+        if (!program){
+            return;
+        }
+
+        const std::uint64_t key = (static_cast<std::uint64_t>(*program) << 32) | static_cast<std::uint32_t>(location);
+        std::vector<std::byte> &previous_value = bindings.uniform_values[key];
+        if (previous_value.size() == size && std::memcmp(previous_value.data(), value, size) == 0){
+            ++counters.redundant_uniform_sets;
+        }
+        else{
+            const auto *bytes = static_cast<const std::byte*>(value);
+            previous_value.assign(bytes, bytes + size);
+        }
+    }
+
+    std::size_t getPixelSize(GLenum format, GLenum type){
+        switch (type){
+            case GL_UNSIGNED_BYTE_3_3_2: case GL_UNSIGNED_BYTE_2_3_3_REV:
+                return 1;
+            case GL_UNSIGNED_SHORT_5_6_5: case GL_UNSIGNED_SHORT_5_6_5_REV: case GL_UNSIGNED_SHORT_4_4_4_4:
+            case GL_UNSIGNED_SHORT_4_4_4_4_REV: case GL_UNSIGNED_SHORT_5_5_5_1: case GL_UNSIGNED_SHORT_1_5_5_5_REV:
+                return 2;
+            case GL_UNSIGNED_INT_8_8_8_8: case GL_UNSIGNED_INT_8_8_8_8_REV: case GL_UNSIGNED_INT_10_10_10_2:
+            case GL_UNSIGNED_INT_2_10_10_10_REV: case GL_UNSIGNED_INT_24_8: case GL_UNSIGNED_INT_10F_11F_11F_REV:
+            case GL_UNSIGNED_INT_5_9_9_9_REV:
+                return 4;
+            case GL_FLOAT_32_UNSIGNED_INT_24_8_REV:
+                return 8;
+            default:
+                break;
+        }
+
+        const std::size_t component_size = [=]() -> std::size_t {
+            switch (type){
+                case GL_UNSIGNED_BYTE: case GL_BYTE: return 1;
+                case GL_UNSIGNED_SHORT: case GL_SHORT: case GL_HALF_FLOAT: return 2;
+                default: return 4;
+            }
+        }();
+        const std::size_t component_count = [=]() -> std::size_t {
+            switch (format){
+                case GL_RG: case GL_RG_INTEGER: return 2;
+                case GL_RGB: case GL_BGR: case GL_RGB_INTEGER: case GL_BGR_INTEGER: return 3;
+                case GL_RGBA: case GL_BGRA: case GL_RGBA_INTEGER: case GL_BGRA_INTEGER: return 4;
+                default: return 1;
+            }
+        }();
+        return component_size * component_count;
+    }
+
+    void uploadTexture(GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLenum type, const void *pixels){
+        // With a pixel unpack buffer bound, pixels is an offset into it, and the data is still transferred.
+        const auto unpack_buffer = bindings.buffers.find(GL_PIXEL_UNPACK_BUFFER);
+        const bool has_unpack_buffer = unpack_buffer != bindings.buffers.end() && unpack_buffer->second != 0;
+        if (pixels || has_unpack_buffer){
+            counters.texture_upload_bytes += static_cast<std::size_t>(width) * height * depth * getPixelSize(format, type);
+        }
+    }
+
+    template <Entry E> struct Tag {};
+
+    constexpr bool isDraw(Entry entry){
+        return entry == Entry::DrawArrays || entry == Entry::DrawElements || entry == Entry::DrawArraysInstanced
+            || entry == Entry::DrawElementsInstanced || entry == Entry::DrawElementsBaseVertex || entry == Entry::DrawRangeElements;
+    }
+
+    // Entry points without any special handling are only counted.
+    template <Entry E, typename... Args>
+    void inspect(Tag<E>, const Args&...) { }
+
+    template <Entry E, typename... Args> requires (isDraw(E))
+    void inspect(Tag<E>, const Args&...) {
+        ++counters.draw_calls;
+    }
+
+    void inspect(Tag<Entry::MultiDrawArrays>, GLenum, const GLint*, const GLsizei*, GLsizei draw_count) {
+        counters.draw_calls += draw_count;
+    }
+
+    void inspect(Tag<Entry::MultiDrawElements>, GLenum, const GLsizei*, GLenum, const void *const*, GLsizei draw_count) {
+        counters.draw_calls += draw_count;
+    }
+
+    void inspect(Tag<Entry::UseProgram>, GLuint program) {
+        bind(bindings.program, program);
+    }
+
+    void inspect(Tag<Entry::LinkProgram>, GLuint program) {
+        // Relinking resets the uniform values.
+        forgetUniformValues(program);
+    }
+
+    void inspect(Tag<Entry::DeleteProgram>, GLuint program) {
+        forgetUniformValues(program);
+    }
+
+    void inspect(Tag<Entry::BindBuffer>, GLenum target, GLuint buffer) {
+        bind(bindings.buffers, target, buffer);
+    }
+
+    void inspect(Tag<Entry::BindBufferBase>, GLenum target, GLuint index, GLuint buffer) {
+        bind(bindings.indexed_buffers, std::pair { target, index }, buffer);
+        bindings.buffers[target] = buffer;
+    }
+
+    void inspect(Tag<Entry::BindBufferRange>, GLenum target, GLuint index, GLuint buffer, GLintptr, GLsizeiptr) {
+        // The range may differ, so never redundant.
+        bindings.indexed_buffers.erase({ target, index });
+        bindings.buffers[target] = buffer;
+        ++counters.state_changes;
+    }
+
+    void inspect(Tag<Entry::BindVertexArray>, GLuint vertex_array) {
+        bind(bindings.vertex_array, vertex_array);
+        // Element array buffer binding is a part of the vertex array state.
+        bindings.buffers.erase(GL_ELEMENT_ARRAY_BUFFER);
+    }
+
+    void inspect(Tag<Entry::BindFramebuffer>, GLenum target, GLuint framebuffer) {
+        if (target == GL_FRAMEBUFFER){
+            const bool redundant = bindings.read_framebuffer == framebuffer && bindings.draw_framebuffer == framebuffer;
+            ++(redundant ? counters.redundant_binds : counters.state_changes);
+            bindings.read_framebuffer = bindings.draw_framebuffer = framebuffer;
+        }
+        else{
+            bind(target == GL_READ_FRAMEBUFFER ? bindings.read_framebuffer : bindings.draw_framebuffer, framebuffer);
+        }
+    }
+
+    void inspect(Tag<Entry::BindRenderbuffer>, GLenum, GLuint renderbuffer) {
+        bind(bindings.renderbuffer, renderbuffer);
+    }
+
+    void inspect(Tag<Entry::ActiveTexture>, GLenum texture) {
+        ++(bindings.active_texture == texture ? counters.redundant_binds : counters.state_changes);
+        bindings.active_texture = texture;
+    }
+
+    void inspect(Tag<Entry::BindTexture>, GLenum target, GLuint texture) {
+        bind(bindings.textures, std::pair { bindings.active_texture, target }, texture);
+    }
+
+    void inspect(Tag<Entry::DeleteBuffers>, GLsizei n, const GLuint *buffers) {
+        unbind(bindings.buffers, { buffers, static_cast<std::size_t>(n) });
+        unbind(bindings.indexed_buffers, { buffers, static_cast<std::size_t>(n) });
+    }
+
+    void inspect(Tag<Entry::DeleteVertexArrays>, GLsizei n, const GLuint *vertex_arrays) {
+        unbind(bindings.vertex_array, { vertex_arrays, static_cast<std::size_t>(n) });
+    }
+
+    void inspect(Tag<Entry::DeleteFramebuffers>, GLsizei n, const GLuint *framebuffers) {
+        unbind(bindings.read_framebuffer, { framebuffers, static_cast<std::size_t>(n) });
+        unbind(bindings.draw_framebuffer, { framebuffers, static_cast<std::size_t>(n) });
+    }
+
+    void inspect(Tag<Entry::DeleteRenderbuffers>, GLsizei n, const GLuint *renderbuffers) {
+        unbind(bindings.renderbuffer, { renderbuffers, static_cast<std::size_t>(n) });
+    }
+
+    void inspect(Tag<Entry::DeleteTextures>, GLsizei n, const GLuint *textures) {
+        unbind(bindings.textures, { textures, static_cast<std::size_t>(n) });
+    }
+
+    void inspect(Tag<Entry::BufferData>, GLenum, GLsizeiptr size, const void *data, GLenum) {
+        if (data){
+            counters.buffer_upload_bytes += static_cast<std::size_t>(size);
+        }
+    }
+
+    void inspect(Tag<Entry::BufferSubData>, GLenum, GLintptr, GLsizeiptr size, const void*) {
+        counters.buffer_upload_bytes += static_cast<std::size_t>(size);
+    }
+
+    void inspect(Tag<Entry::BufferStorage>, GLenum, GLsizeiptr size, const void *data, GLbitfield) {
+        if (data){
+            counters.buffer_upload_bytes += static_cast<std::size_t>(size);
+        }
+    }
+
+    void inspect(Tag<Entry::NamedBufferData>, GLuint, GLsizeiptr size, const void *data, GLenum) {
+        if (data){
+            counters.buffer_upload_bytes += static_cast<std::size_t>(size);
+        }
+    }
+
+    void inspect(Tag<Entry::NamedBufferSubData>, GLuint, GLintptr, GLsizeiptr size, const void*) {
+        counters.buffer_upload_bytes += static_cast<std::size_t>(size);
+    }
+
+    void inspect(Tag<Entry::NamedBufferStorage>, GLuint, GLsizeiptr size, const void *data, GLbitfield) {
+        if (data){
+            counters.buffer_upload_bytes += static_cast<std::size_t>(size);
+        }
+    }
+
+    void inspect(Tag<Entry::TexImage2D>, GLenum, GLint, GLint, GLsizei width, GLsizei height, GLint, GLenum format, GLenum type, const void *pixels) {
+        uploadTexture(width, height, 1, format, type, pixels);
+    }
+
+    void inspect(Tag<Entry::TexSubImage2D>, GLenum, GLint, GLint, GLint, GLsizei width, GLsizei height, GLenum format, GLenum type, const void *pixels) {
+        uploadTexture(width, height, 1, format, type, pixels);
+    }
+
+    void inspect(Tag<Entry::TexImage3D>, GLenum, GLint, GLint, GLsizei width, GLsizei height, GLsizei depth, GLint, GLenum format, GLenum type, const void *pixels) {
+        uploadTexture(width, height, depth, format, type, pixels);
+    }
+
+    void inspect(Tag<Entry::TexSubImage3D>, GLenum, GLint, GLint, GLint, GLint, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLenum type, const void *pixels) {
+        uploadTexture(width, height, depth, format, type, pixels);
+    }
+
+    void inspect(Tag<Entry::TextureSubImage2D>, GLuint, GLint, GLint, GLint, GLsizei width, GLsizei height, GLenum format, GLenum type, const void *pixels) {
+        uploadTexture(width, height, 1, format, type, pixels);
+    }
+
+    void inspect(Tag<Entry::TextureSubImage3D>, GLuint, GLint, GLint, GLint, GLint, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLenum type, const void *pixels) {
+        uploadTexture(width, height, depth, format, type, pixels);
+    }
+
+    void inspect(Tag<Entry::Uniform1i>, GLint location, GLint value) {
+        setUniform(bindings.program, location, &value, sizeof(value));
+    }
+
+    void inspect(Tag<Entry::Uniform1ui>, GLint location, GLuint value) {
+        setUniform(bindings.program, location, &value, sizeof(value));
+    }
+
+    void inspect(Tag<Entry::Uniform1f>, GLint location, GLfloat value) {
+        setUniform(bindings.program, location, &value, sizeof(value));
+    }
+
+    void inspect(Tag<Entry::ProgramUniform1i>, GLuint program, GLint location, GLint value) {
+        setUniform(program, location, &value, sizeof(value));
+    }
+
+    void inspect(Tag<Entry::ProgramUniform1ui>, GLuint program, GLint location, GLuint value) {
+        setUniform(program, location, &value, sizeof(value));
+    }
+
+    void inspect(Tag<Entry::ProgramUniform1f>, GLuint program, GLint location, GLfloat value) {
+        setUniform(program, location, &value, sizeof(value));
+    }
+
+#define OPENGLAPP_INSPECT_UNIFORM_VECTOR(name, type, component_count) \
+    void inspect(Tag<Entry::name>, GLint location, GLsizei count, const type *value) { \
+        setUniform(bindings.program, location, value, sizeof(type) * (component_count) * count); \
+    }
+#define OPENGLAPP_INSPECT_PROGRAM_UNIFORM_VECTOR(name, type, component_count) \
+    void inspect(Tag<Entry::name>, GLuint program, GLint location, GLsizei count, const type *value) { \
+        setUniform(program, location, value, sizeof(type) * (component_count) * count); \
+    }
+    OPENGLAPP_INSPECT_UNIFORM_VECTOR(Uniform1iv, GLint, 1)
+    OPENGLAPP_INSPECT_UNIFORM_VECTOR(Uniform2iv, GLint, 2)
+    OPENGLAPP_INSPECT_UNIFORM_VECTOR(Uniform3iv, GLint, 3)
+    OPENGLAPP_INSPECT_UNIFORM_VECTOR(Uniform4iv, GLint, 4)
+    OPENGLAPP_INSPECT_UNIFORM_VECTOR(Uniform1uiv, GLuint, 1)
+    OPENGLAPP_INSPECT_UNIFORM_VECTOR(Uniform2uiv, GLuint, 2)
+    OPENGLAPP_INSPECT_UNIFORM_VECTOR(Uniform3uiv, GLuint, 3)
+    OPENGLAPP_INSPECT_UNIFORM_VECTOR(Uniform4uiv, GLuint, 4)
+    OPENGLAPP_INSPECT_UNIFORM_VECTOR(Uniform1fv, GLfloat, 1)
+    OPENGLAPP_INSPECT_UNIFORM_VECTOR(Uniform2fv, GLfloat, 2)
+    OPENGLAPP_INSPECT_UNIFORM_VECTOR(Uniform3fv, GLfloat, 3)
+    OPENGLAPP_INSPECT_UNIFORM_VECTOR(Uniform4fv, GLfloat, 4)
+    OPENGLAPP_INSPECT_PROGRAM_UNIFORM_VECTOR(ProgramUniform2iv, GLint, 2)
+    OPENGLAPP_INSPECT_PROGRAM_UNIFORM_VECTOR(ProgramUniform3iv, GLint, 3)
+    OPENGLAPP_INSPECT_PROGRAM_UNIFORM_VECTOR(ProgramUniform4iv, GLint, 4)
+    OPENGLAPP_INSPECT_PROGRAM_UNIFORM_VECTOR(ProgramUniform2uiv, GLuint, 2)
+    OPENGLAPP_INSPECT_PROGRAM_UNIFORM_VECTOR(ProgramUniform3uiv, GLuint, 3)
+    OPENGLAPP_INSPECT_PROGRAM_UNIFORM_VECTOR(ProgramUniform4uiv, GLuint, 4)
+    OPENGLAPP_INSPECT_PROGRAM_UNIFORM_VECTOR(ProgramUniform2fv, GLfloat, 2)
+    OPENGLAPP_INSPECT_PROGRAM_UNIFORM_VECTOR(ProgramUniform3fv, GLfloat, 3)
+    OPENGLAPP_INSPECT_PROGRAM_UNIFORM_VECTOR(ProgramUniform4fv, GLfloat, 4)
+#undef OPENGLAPP_INSPECT_UNIFORM_VECTOR
+#undef OPENGLAPP_INSPECT_PROGRAM_UNIFORM_VECTOR
+
+#define OPENGLAPP_INSPECT_UNIFORM_MATRIX(name, dimension) \
+    void inspect(Tag<Entry::name>, GLint location, GLsizei count, GLboolean, const GLfloat *value) { \
+        setUniform(bindings.program, location, value, sizeof(GLfloat) * (dimension) * (dimension) * count); \
+    }
+#define OPENGLAPP_INSPECT_PROGRAM_UNIFORM_MATRIX(name, dimension) \
+    void inspect(Tag<Entry::name>, GLuint program, GLint location, GLsizei count, GLboolean, const GLfloat *value) { \
+        setUniform(program, location, value, sizeof(GLfloat) * (dimension) * (dimension) * count); \
+    }
+    OPENGLAPP_INSPECT_UNIFORM_MATRIX(UniformMatrix2fv, 2)
+    OPENGLAPP_INSPECT_UNIFORM_MATRIX(UniformMatrix3fv, 3)
+    OPENGLAPP_INSPECT_UNIFORM_MATRIX(UniformMatrix4fv, 4)
+    OPENGLAPP_INSPECT_PROGRAM_UNIFORM_MATRIX(ProgramUniformMatrix3fv, 3)
+    OPENGLAPP_INSPECT_PROGRAM_UNIFORM_MATRIX(ProgramUniformMatrix4fv, 4)
+#undef OPENGLAPP_INSPECT_UNIFORM_MATRIX
+#undef OPENGLAPP_INSPECT_PROGRAM_UNIFORM_MATRIX
+
+    // Hook<E, F>::call has the same signature as the intercepted function, and forwards the call to the original
+    // function after updating the counters.
+    template <Entry E, typename Function>
+    struct Hook;
+
+    template <Entry E, typename R, typename... Args>
+    struct Hook<E, R (APIENTRY *)(Args...)>{
+        static inline R (APIENTRY *original)(Args...) = nullptr;
+
+        static R APIENTRY call(Args... args) {
+            ++counters.calls[static_cast<std::size_t>(E)];
+            inspect(Tag<E>{}, args...);
+            return original(args...);
+        }
+    };
+
+    template <Entry E, typename Function>
+    void install(Function &pointer) {
+        Hook<E, Function>::original = pointer;
+        // Entry points the context does not support (e.g. the DSA ones before GL 4.5) stay null, so that checking
+        // them for availability still works.
+        if (pointer){
+            pointer = &Hook<E, Function>::call;
+        }
+    }
+
+    template <Entry E, typename Function>
+    void uninstall(Function &pointer) {
+        pointer = Hook<E, Function>::original;
+    }
+}
+
+void OpenGL::GLIntercept::enable() {
+    if (enabled){
+        return;
+    }
+
+    counters = {};
+    bindings = {};
+    GLint active_texture;
+    glGetIntegerv(GL_ACTIVE_TEXTURE, &active_texture);
+    bindings.active_texture = static_cast<GLenum>(active_texture);
+
+#define OPENGLAPP_INSTALL_GLEW_ENTRY(name) install<Entry::name>(__glew##name);
+#define OPENGLAPP_INSTALL_CORE_ENTRY(name) install<Entry::name>(core::name);
+    OPENGLAPP_GL_INTERCEPT_GLEW_ENTRIES(OPENGLAPP_INSTALL_GLEW_ENTRY)
+    OPENGLAPP_GL_INTERCEPT_CORE_ENTRIES(OPENGLAPP_INSTALL_CORE_ENTRY)
+#undef OPENGLAPP_INSTALL_GLEW_ENTRY
+#undef OPENGLAPP_INSTALL_CORE_ENTRY
+
+    enabled = true;
+}
+
+void OpenGL::GLIntercept::disable() {
+    if (!enabled){
+        return;
+    }
+
+#define OPENGLAPP_UNINSTALL_GLEW_ENTRY(name) uninstall<Entry::name>(__glew##name);
+#define OPENGLAPP_UNINSTALL_CORE_ENTRY(name) uninstall<Entry::name>(core::name);
+    OPENGLAPP_GL_INTERCEPT_GLEW_ENTRIES(OPENGLAPP_UNINSTALL_GLEW_ENTRY)
+    OPENGLAPP_GL_INTERCEPT_CORE_ENTRIES(OPENGLAPP_UNINSTALL_CORE_ENTRY)
+#undef OPENGLAPP_UNINSTALL_GLEW_ENTRY
+#undef OPENGLAPP_UNINSTALL_CORE_ENTRY
+
+    enabled = false;
+}
+
+bool OpenGL::GLIntercept::isEnabled() noexcept {
+    return enabled;
+}
+
+void OpenGL::GLIntercept::endFrame() {
+    frame_statistics.call_counts.clear();
+    frame_statistics.total_calls = 0;
+    for (std::size_t index = 0; index < entry_count; ++index){
+        if (counters.calls[index] != 0){
+            frame_statistics.call_counts.emplace_back(entry_names[index], counters.calls[index]);
+            frame_statistics.total_calls += counters.calls[index];
+        }
+    }
+    std::ranges::sort(frame_statistics.call_counts, std::greater{}, &CallCount::count);
+
+    frame_statistics.draw_calls = counters.draw_calls;
+    frame_statistics.state_changes = counters.state_changes;
+    frame_statistics.redundant_binds = counters.redundant_binds;
+    frame_statistics.uniform_sets = counters.uniform_sets;
+    frame_statistics.redundant_uniform_sets = counters.redundant_uniform_sets;
+    frame_statistics.buffer_upload_bytes = counters.buffer_upload_bytes;
+    frame_statistics.texture_upload_bytes = counters.texture_upload_bytes;
+
+    counters = {};
+}
+
+const OpenGL::GLIntercept::FrameStatistics &OpenGL::GLIntercept::getFrameStatistics() noexcept {
+    return frame_statistics;
+}
+
+void OpenGL::GLIntercept::dumpFrameStatistics(std::ostream &stream) {
+    stream << "GL calls: " << frame_statistics.total_calls
+           << ", draw calls: " << frame_statistics.draw_calls
+           << ", state changes: " << frame_statistics.state_changes
+           << ", redundant binds: " << frame_statistics.redundant_binds
+           << ", uniform sets: " << frame_statistics.uniform_sets << " (" << frame_statistics.redundant_uniform_sets << " redundant)"
+           << ", uploaded: " << frame_statistics.buffer_upload_bytes << " B buffer, " << frame_statistics.texture_upload_bytes << " B texture\n";
+    for (const CallCount &call_count : frame_statistics.call_counts){
+        stream << "  " << call_count.name << ": " << call_count.count << '\n';
+    }
+}
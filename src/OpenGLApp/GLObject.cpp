@@ -0,0 +1,147 @@
+//
+// Created by gomkyung2 on 2026/10/19.
+//
+
+#include "OpenGLApp/GLObject.hpp"
+
+#include <algorithm>
+#include <array>
+#include <deque>
+#include <vector>
+
+#include "OpenGLApp/Capabilities.hpp"
+#include "OpenGLApp/GLInterceptCore.hpp"
+
+namespace{
+    constexpr std::size_t type_count = 5;
+
+    using HandleLists = std::array<std::vector<GLuint>, type_count>;
+
+    struct PendingDeletion{
+        GLsync fence;
+        HandleLists handles;
+    };
+
+    HandleLists free_handles;
+    HandleLists released_handles; // Released in the current frame.
+    std::deque<PendingDeletion> pending_deletions;
+    std::array<std::size_t, type_count> generated_counts {};
+    std::size_t deleted_count = 0;
+
+    void generateHandles(OpenGL::ObjectType type, GLsizei count, GLuint *handles){
+        // glCreate* creates the objects right away, so that glNamed* can be used before they are bound. Textures are
+        // excluded since glCreateTextures fixes their target.
+        if (OpenGL::Capabilities::get().direct_state_access){
+            switch (type){
+                case OpenGL::ObjectType::Buffer:       glCreateBuffers(count, handles); return;
+                case OpenGL::ObjectType::VertexArray:  glCreateVertexArrays(count, handles); return;
+                case OpenGL::ObjectType::Framebuffer:  glCreateFramebuffers(count, handles); return;
+                case OpenGL::ObjectType::Renderbuffer: glCreateRenderbuffers(count, handles); return;
+                case OpenGL::ObjectType::Texture:      break;
+            }
+        }
+
+        switch (type){
+            case OpenGL::ObjectType::Buffer:       glGenBuffers(count, handles); break;
+            case OpenGL::ObjectType::VertexArray:  glGenVertexArrays(count, handles); break;
+            case OpenGL::ObjectType::Texture:      glGenTextures(count, handles); break;
+            case OpenGL::ObjectType::Framebuffer:  glGenFramebuffers(count, handles); break;
+            case OpenGL::ObjectType::Renderbuffer: glGenRenderbuffers(count, handles); break;
+        }
+    }
+
+    void deleteHandles(HandleLists &handles){
+        for (std::size_t type = 0; type < type_count; ++type){
+            std::vector<GLuint> &list = handles[type];
+            if (list.empty()){
+                continue;
+            }
+
+            const auto count = static_cast<GLsizei>(list.size());
+            switch (static_cast<OpenGL::ObjectType>(type)){
+                case OpenGL::ObjectType::Buffer:       glDeleteBuffers(count, list.data()); break;
+                case OpenGL::ObjectType::VertexArray:  glDeleteVertexArrays(count, list.data()); break;
+                case OpenGL::ObjectType::Texture:      glDeleteTextures(count, list.data()); break;
+                case OpenGL::ObjectType::Framebuffer:  glDeleteFramebuffers(count, list.data()); break;
+                case OpenGL::ObjectType::Renderbuffer: glDeleteRenderbuffers(count, list.data()); break;
+            }
+            deleted_count += list.size();
+            list.clear();
+        }
+    }
+
+    [[nodiscard]] std::size_t countHandles(const HandleLists &handles) noexcept {
+        std::size_t count = 0;
+        for (const std::vector<GLuint> &list : handles){
+            count += list.size();
+        }
+        return count;
+    }
+}
+
+GLuint OpenGL::ObjectPool::acquire(ObjectType type) {
+    std::vector<GLuint> &list = free_handles[static_cast<std::size_t>(type)];
+    if (list.empty()){
+        // Grow the batch with the usage, rather than generating handles one by one.
+        std::size_t &generated_count = generated_counts[static_cast<std::size_t>(type)];
+        const std::size_t batch_size = std::clamp<std::size_t>(generated_count, 16, 256);
+        list.resize(batch_size);
+        generateHandles(type, static_cast<GLsizei>(batch_size), list.data());
+        generated_count += batch_size;
+    }
+
+    const GLuint handle = list.back();
+    list.pop_back();
+    return handle;
+}
+
+void OpenGL::ObjectPool::release(ObjectType type, GLuint handle) {
+    if (handle != 0){
+        released_handles[static_cast<std::size_t>(type)].push_back(handle);
+    }
+}
+
+void OpenGL::ObjectPool::endFrame() {
+    if (countHandles(released_handles) != 0){
+        pending_deletions.emplace_back(glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0), std::exchange(released_handles, {}));
+    }
+
+    // Fences are signaled in order, so stop at the first unsignaled one.
+    while (!pending_deletions.empty()){
+        PendingDeletion &deletion = pending_deletions.front();
+        if (const GLenum result = glClientWaitSync(deletion.fence, 0, 0); result != GL_ALREADY_SIGNALED && result != GL_CONDITION_SATISFIED){
+            break;
+        }
+
+        glDeleteSync(deletion.fence);
+        deleteHandles(deletion.handles);
+        pending_deletions.pop_front();
+    }
+}
+
+void OpenGL::ObjectPool::flush() {
+    glFinish();
+
+    for (PendingDeletion &deletion : pending_deletions){
+        glDeleteSync(deletion.fence);
+        deleteHandles(deletion.handles);
+    }
+    pending_deletions.clear();
+
+    deleteHandles(released_handles);
+    deleteHandles(free_handles);
+}
+
+OpenGL::ObjectPool::Statistics OpenGL::ObjectPool::getStatistics() noexcept {
+    std::size_t generated_count = 0;
+    for (std::size_t count : generated_counts){
+        generated_count += count;
+    }
+
+    std::size_t pending_count = countHandles(released_handles);
+    for (const PendingDeletion &deletion : pending_deletions){
+        pending_count += countHandles(deletion.handles);
+    }
+
+    return { generated_count, countHandles(free_handles), pending_count, deleted_count };
+}
@@ -0,0 +1,144 @@
+//
+// Created by gomkyung2 on 2026/10/19.
+//
+
+#include "OpenGLApp/GoldenImageTest.hpp"
+
+#include <algorithm>
+#include <cctype>
+#include <cstdlib>
+#include <exception>
+#include <optional>
+#include <stdexcept>
+#include <type_traits>
+
+#include "OpenGLApp/Utils/Image.hpp"
+
+namespace{
+    template <typename T>
+    T getEnvironment(const char *name, T default_value){
+        const char *value = std::getenv(name);
+        if (!value || *value == '\0'){
+            return default_value;
+        }
+
+        if constexpr (std::is_floating_point_v<T>){
+            return static_cast<T>(std::strtod(value, nullptr));
+        }
+        else{
+            return static_cast<T>(std::strtol(value, nullptr, 10));
+        }
+    }
+
+    std::string sanitizeFilename(std::string_view name){
+        std::string result { name };
+        std::ranges::replace_if(result, [](char c){
+            return !(std::isalnum(static_cast<unsigned char>(c)) || c == '-' || c == '_' || c == '.');
+        }, '_');
+        return result;
+    }
+}
+
+void OpenGL::GoldenImageTest::compare(FrameCapture::Frame &&frame_data) {
+    try{
+        if (!frame_data.isValid()){
+            throw std::runtime_error { "Failed to read back the captured frame." };
+        }
+
+        if (options.update){
+            std::filesystem::create_directories(options.reference_filename.parent_path());
+            if (!FrameCapture::writeFile(frame_data, options.reference_filename)){
+                throw std::runtime_error { "Failed to write the reference image " + options.reference_filename.string() + "." };
+            }
+            result.set_value();
+            return;
+        }
+
+        const std::filesystem::path actual_filename = std::filesystem::path { options.reference_filename }.replace_extension(".actual.png");
+        const auto fail = [&](const std::string &message){
+            FrameCapture::writeFile(frame_data, actual_filename);
+            throw std::runtime_error { message + " The captured frame is written to " + actual_filename.string() + "." };
+        };
+
+        std::optional<Utils::Image> reference;
+        try{
+            reference.emplace(options.reference_filename.string().c_str(), Utils::Image::LoadOptions { Utils::Image::PixelLayout::Rgba, Utils::Image::ColorSpace::Srgb });
+        }
+        catch (const std::runtime_error&){
+            fail("Failed to read the reference image " + options.reference_filename.string() + ". Run with OPENGLAPP_GOLDEN_UPDATE=1 to create it.");
+        }
+
+        if (reference->getWidth() != frame_data.width || reference->getHeight() != frame_data.height){
+            fail("Size of the frame (" + std::to_string(frame_data.width) + "x" + std::to_string(frame_data.height) +
+                 ") differs from the reference (" + std::to_string(reference->getWidth()) + "x" + std::to_string(reference->getHeight()) + ").");
+        }
+
+        // A pixel mismatches if any channel differs more than the tolerance, which absorbs the rounding differences
+        // between drivers.
+        const unsigned char *expected = reference->getData();
+        std::size_t mismatch_count = 0;
+        for (std::size_t offset = 0; offset < frame_data.pixels.size(); offset += 4){
+            for (std::size_t channel = 0; channel < 4; ++channel){
+                if (std::abs(frame_data.pixels[offset + channel] - expected[offset + channel]) > options.tolerance){
+                    ++mismatch_count;
+                    break;
+                }
+            }
+        }
+
+        const std::size_t pixel_count = frame_data.pixels.size() / 4;
+        if (static_cast<float>(mismatch_count) > options.max_mismatch_ratio * static_cast<float>(pixel_count)){
+            fail(std::to_string(mismatch_count) + " of " + std::to_string(pixel_count) + " pixels differ from the reference " +
+                 options.reference_filename.string() + ".");
+        }
+        result.set_value();
+    }
+    catch (...){
+        result.set_exception(std::current_exception());
+    }
+}
+
+OpenGL::GoldenImageTest::GoldenImageTest(Options options) : options { std::move(options) } {
+
+}
+
+std::unique_ptr<OpenGL::GoldenImageTest> OpenGL::GoldenImageTest::fromEnvironment(std::string_view name) {
+    const char *directory = std::getenv("OPENGLAPP_GOLDEN_DIR");
+    if (!directory){
+        return nullptr;
+    }
+
+    // Window titles need not be unique, so the test runner may give the name explicitly.
+    if (const char *golden_name = std::getenv("OPENGLAPP_GOLDEN_NAME"); golden_name && *golden_name != '\0'){
+        name = golden_name;
+    }
+
+    Options options { std::filesystem::path { directory } / (sanitizeFilename(name) + ".png") };
+    options.frame_count = std::max(getEnvironment("OPENGLAPP_GOLDEN_FRAMES", options.frame_count), 1U);
+    options.tolerance = getEnvironment("OPENGLAPP_GOLDEN_TOLERANCE", options.tolerance);
+    options.max_mismatch_ratio = getEnvironment("OPENGLAPP_GOLDEN_MAX_MISMATCH", options.max_mismatch_ratio);
+    options.update = getEnvironment("OPENGLAPP_GOLDEN_UPDATE", 0) != 0;
+    return std::make_unique<GoldenImageTest>(std::move(options));
+}
+
+float OpenGL::GoldenImageTest::getTimeDelta() noexcept {
+    return 1.f / 60.f;
+}
+
+bool OpenGL::GoldenImageTest::endFrame(glm::ivec2 framebuffer_size) {
+    if (++frame == options.frame_count){
+        frame_capture.capture(0, GL_BACK, framebuffer_size, [this](FrameCapture::Frame &&frame_data){
+            compare(std::move(frame_data));
+        });
+    }
+    return frame >= options.frame_count;
+}
+
+void OpenGL::GoldenImageTest::check() {
+    if (frame < options.frame_count){
+        throw std::runtime_error { "Window was closed before the golden image was captured." };
+    }
+
+    frame_capture.flush();
+    result_future.get();
+}
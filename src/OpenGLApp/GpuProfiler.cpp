@@ -0,0 +1,93 @@
+//
+// Created by gomkyung2 on 2026/10/19.
+//
+
+#include "OpenGLApp/GpuProfiler.hpp"
+
+#include <algorithm>
+#include <cassert>
+
+OpenGL::GpuProfiler::Scope::Scope(GpuProfiler &profiler, const char *name) : profiler { profiler } {
+    Frame &frame = profiler.frames[profiler.frame_index];
+    marker_index = frame.markers.size();
+
+    Marker &marker = frame.markers.emplace_back(name, profiler.current_depth++, profiler.acquireQuery(), profiler.acquireQuery());
+    glQueryCounter(marker.begin_query, GL_TIMESTAMP);
+    marker.cpu_begin = std::chrono::steady_clock::now();
+}
+
+OpenGL::GpuProfiler::Scope::~Scope() noexcept {
+    Marker &marker = profiler.frames[profiler.frame_index].markers[marker_index];
+    marker.cpu_end = std::chrono::steady_clock::now();
+    glQueryCounter(marker.end_query, GL_TIMESTAMP);
+    --profiler.current_depth;
+}
+
+OpenGL::GpuProfiler::~GpuProfiler() noexcept {
+    for (Frame &frame : frames){
+        glDeleteQueries(static_cast<GLsizei>(frame.queries.size()), frame.queries.data());
+    }
+}
+
+GLuint OpenGL::GpuProfiler::acquireQuery() {
+    Frame &frame = frames[frame_index];
+    if (frame.used_query_count == frame.queries.size()){
+        // Grow the pool in batches, rather than generating query objects one by one.
+        const std::size_t batch_size = std::max<std::size_t>(frame.queries.size(), 16);
+        frame.queries.resize(frame.queries.size() + batch_size);
+        glGenQueries(static_cast<GLsizei>(batch_size), frame.queries.data() + frame.used_query_count);
+    }
+    return frame.queries[frame.used_query_count++];
+}
+
+void OpenGL::GpuProfiler::resolve(Frame &frame) {
+    // If the GPU is still more than frame_latency - 1 frames behind, reading the results would stall. Skip the frame
+    // and keep the previous results instead. The begin query of a marker precedes its end query, so checking the end
+    // queries is enough.
+    const bool available = std::ranges::all_of(frame.markers, [](const Marker &marker){
+        GLint end_available;
+        glGetQueryObjectiv(marker.end_query, GL_QUERY_RESULT_AVAILABLE, &end_available);
+        return end_available == GL_TRUE;
+    });
+
+    if (available){
+        results.clear();
+        for (const Marker &marker : frame.markers){
+            GLuint64 begin_timestamp, end_timestamp;
+            glGetQueryObjectui64v(marker.begin_query, GL_QUERY_RESULT, &begin_timestamp);
+            glGetQueryObjectui64v(marker.end_query, GL_QUERY_RESULT, &end_timestamp);
+
+            results.emplace_back(
+                marker.name,
+                marker.depth,
+                std::chrono::duration<float, std::milli> { marker.cpu_end - marker.cpu_begin }.count(),
+                static_cast<float>(end_timestamp - begin_timestamp) * 1e-6f
+            );
+        }
+    }
+
+    frame.markers.clear();
+    frame.used_query_count = 0;
+}
+
+void OpenGL::GpuProfiler::beginFrame() {
+    assert(current_depth == 0 && "Scope is not closed.");
+
+    frame_index = (frame_index + 1) % frame_latency;
+    Frame &frame = frames[frame_index];
+    if (!frame.markers.empty()){
+        resolve(frame);
+    }
+}
+
+void OpenGL::GpuProfiler::endFrame() {
+    assert(current_depth == 0 && "Scope is not closed.");
+}
+
+OpenGL::GpuProfiler::Scope OpenGL::GpuProfiler::scope(const char *name) {
+    return { *this, name };
+}
+
+std::span<const OpenGL::GpuProfiler::Result> OpenGL::GpuProfiler::getResults() const noexcept {
+    return results;
+}
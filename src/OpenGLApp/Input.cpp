@@ -0,0 +1,71 @@
+//
+// Created by gomkyung2 on 2026/10/19.
+//
+
+#include "OpenGLApp/Input.hpp"
+
+namespace{
+    template <typename... Ts>
+    struct overloaded : Ts... { using Ts::operator()...; };
+}
+
+bool OpenGL::InputEventQueue::push(const InputEvent &event) noexcept {
+    if (size != 0){
+        InputEvent &last = events[size - 1];
+        if (auto *cursor_pos = std::get_if<CursorPosEvent>(&last); cursor_pos && std::holds_alternative<CursorPosEvent>(event)){
+            cursor_pos->position = std::get<CursorPosEvent>(event).position;
+            return true;
+        }
+        if (auto *scroll = std::get_if<ScrollEvent>(&last); scroll && std::holds_alternative<ScrollEvent>(event)){
+            scroll->offset += std::get<ScrollEvent>(event).offset;
+            return true;
+        }
+    }
+
+    if (size == capacity){
+        return false;
+    }
+    events[size++] = event;
+    return true;
+}
+
+bool OpenGL::InputEventQueue::empty() const noexcept {
+    return size == 0;
+}
+
+bool OpenGL::InputState::isKeyPressed(int key) const noexcept {
+    return key >= 0 && key < static_cast<int>(pressed_keys.size()) && pressed_keys.test(key);
+}
+
+bool OpenGL::InputState::isMouseButtonPressed(int button) const noexcept {
+    return button >= 0 && button < static_cast<int>(pressed_mouse_buttons.size()) && pressed_mouse_buttons.test(button);
+}
+
+void OpenGL::InputState::consumeDeltas() noexcept {
+    cursor_delta = glm::dvec2 { 0.0 };
+    scroll_delta = glm::dvec2 { 0.0 };
+}
+
+void OpenGL::InputState::apply(const InputEvent &event) noexcept {
+    std::visit(overloaded {
+        [this](const KeyEvent &e) {
+            if (e.key >= 0 && e.key < static_cast<int>(pressed_keys.size()) && e.action != GLFW_REPEAT){
+                pressed_keys.set(e.key, e.action == GLFW_PRESS);
+            }
+        },
+        [this](const MouseButtonEvent &e) {
+            if (e.button >= 0 && e.button < static_cast<int>(pressed_mouse_buttons.size())){
+                pressed_mouse_buttons.set(e.button, e.action == GLFW_PRESS);
+            }
+        },
+        [this](const CursorPosEvent &e) {
+            if (cursor_position.has_value()){
+                cursor_delta += e.position - cursor_position.value();
+            }
+            cursor_position = e.position;
+        },
+        [this](const ScrollEvent &e) {
+            scroll_delta += e.offset;
+        }
+    }, event);
+}
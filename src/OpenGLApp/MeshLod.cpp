@@ -0,0 +1,566 @@
+//
+// Created by gomkyung2 on 2026/10/19.
+//
+
+#include "OpenGLApp/MeshLod.hpp"
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cmath>
+#include <functional>
+#include <limits>
+#include <optional>
+#include <queue>
+#include <stdexcept>
+#include <unordered_map>
+
+#include <glm/geometric.hpp>
+#include <glm/ext/vector_float4.hpp>
+
+namespace{
+    // Boundary constraint planes are weighted so that collapses across an open boundary cost more than along it.
+    constexpr double boundary_weight = 10.0;
+
+    struct Vector{
+        double x, y, z;
+
+        Vector(double x, double y, double z) noexcept : x { x }, y { y }, z { z } { }
+        explicit Vector(const glm::vec3 &v) noexcept : x { v.x }, y { v.y }, z { v.z } { }
+
+        Vector operator-(const Vector &other) const noexcept {
+            return { x - other.x, y - other.y, z - other.z };
+        }
+
+        [[nodiscard]] double dot(const Vector &other) const noexcept {
+            return x * other.x + y * other.y + z * other.z;
+        }
+
+        [[nodiscard]] Vector cross(const Vector &other) const noexcept {
+            return { y * other.z - z * other.y, z * other.x - x * other.z, x * other.y - y * other.x };
+        }
+    };
+
+    // Symmetric 4x4 matrix A of the quadric error vᵀAv, the sum of the squared distances from v = (x, y, z, 1) to a set
+    // of planes. Upper triangle in row-major order.
+    struct Quadric{
+        std::array<double, 10> a {};
+
+        static Quadric fromPlane(const Vector &normal, double d, double weight) noexcept {
+            const double x = normal.x, y = normal.y, z = normal.z;
+            Quadric quadric;
+            quadric.a = { x * x, x * y, x * z, x * d, y * y, y * z, y * d, z * z, z * d, d * d };
+            for (double &element : quadric.a){
+                element *= weight;
+            }
+            return quadric;
+        }
+
+        Quadric &operator+=(const Quadric &other) noexcept {
+            for (std::size_t i = 0; i < a.size(); ++i){
+                a[i] += other.a[i];
+            }
+            return *this;
+        }
+
+        [[nodiscard]] double evaluate(const Vector &v) const noexcept {
+            const double x = v.x, y = v.y, z = v.z;
+            return a[0] * x * x + 2.0 * a[1] * x * y + 2.0 * a[2] * x * z + 2.0 * a[3] * x
+                 + a[4] * y * y + 2.0 * a[5] * y * z + 2.0 * a[6] * y
+                 + a[7] * z * z + 2.0 * a[8] * z
+                 + a[9];
+        }
+    };
+
+    struct PositionHash{
+        std::size_t operator()(const glm::vec3 &position) const noexcept {
+            std::size_t seed = 0;
+            for (float component : { position.x, position.y, position.z }){
+                // +0 so that -0.f and 0.f, which compare equal, hash equally.
+                seed ^= std::hash<std::uint32_t>{}(std::bit_cast<std::uint32_t>(component + 0.f)) + 0x9e3779b9 + (seed << 6) + (seed >> 2);
+            }
+            return seed;
+        }
+    };
+
+    struct PositionEqual{
+        bool operator()(const glm::vec3 &lhs, const glm::vec3 &rhs) const noexcept {
+            return lhs.x == rhs.x && lhs.y == rhs.y && lhs.z == rhs.z;
+        }
+    };
+
+    // Half-edge collapse of welded vertex from onto welded vertex to.
+    struct Collapse{
+        double cost; // Lower bound, since the quadrics only grow: re-evaluated when popped.
+        std::uint32_t from, to;
+
+        bool operator>(const Collapse &other) const noexcept {
+            return cost > other.cost;
+        }
+    };
+
+    class Simplifier{
+    private:
+        std::span<const glm::vec3> positions;
+
+        // Vertices at the same position are welded into one, to which the quadric and the adjacency belong.
+        std::vector<std::uint32_t> weld; // Original vertex -> welded vertex.
+        std::vector<std::uint32_t> representatives; // Welded vertex -> its first original vertex.
+        std::vector<Quadric> quadrics;
+        std::vector<bool> collapsed;
+        std::vector<std::vector<std::uint32_t>> vertex_triangles; // May have triangles removed or no longer around.
+
+        std::vector<std::array<std::uint32_t, 3>> triangles; // Original vertex indices.
+        std::vector<bool> removed;
+        std::size_t triangle_count = 0;
+
+        std::priority_queue<Collapse, std::vector<Collapse>, std::greater<>> queue;
+        double max_cost = 0.0;
+
+        [[nodiscard]] const glm::vec3 &getPosition(std::uint32_t welded) const noexcept {
+            return positions[representatives[welded]];
+        }
+
+        [[nodiscard]] bool isAround(std::uint32_t triangle, std::uint32_t welded) const noexcept {
+            const auto &corners = triangles[triangle];
+            return !removed[triangle] && (weld[corners[0]] == welded || weld[corners[1]] == welded || weld[corners[2]] == welded);
+        }
+
+        [[nodiscard]] double getCost(std::uint32_t from, std::uint32_t to) const noexcept {
+            Quadric quadric = quadrics[from];
+            quadric += quadrics[to];
+            return std::max(quadric.evaluate(Vector { getPosition(to) }), 0.0);
+        }
+
+        void push(std::uint32_t from, std::uint32_t to){
+            queue.push({ getCost(from, to), from, to });
+        }
+
+        // Whether moving from onto to keeps every triangle around from, which does not also have to, facing the same way.
+        [[nodiscard]] bool isCollapseValid(std::uint32_t from, std::uint32_t to) const noexcept {
+            bool adjacent = false;
+            const Vector moved { getPosition(to) };
+            for (std::uint32_t triangle : vertex_triangles[from]){
+                if (!isAround(triangle, from)){
+                    continue;
+                }
+                if (isAround(triangle, to)){
+                    adjacent = true;
+                    continue;
+                }
+
+                const auto &corners = triangles[triangle];
+                std::array<Vector, 3> before {
+                    Vector { positions[corners[0]] }, Vector { positions[corners[1]] }, Vector { positions[corners[2]] }
+                };
+                std::array<Vector, 3> after = before;
+                for (std::size_t i = 0; i < 3; ++i){
+                    if (weld[corners[i]] == from){
+                        after[i] = moved;
+                    }
+                }
+
+                const Vector normal_before = (before[1] - before[0]).cross(before[2] - before[0]);
+                const Vector normal_after = (after[1] - after[0]).cross(after[2] - after[0]);
+                if (normal_before.dot(normal_after) <= 0.0){
+                    return false;
+                }
+            }
+            return adjacent;
+        }
+
+        // Corner of to in a triangle around to, but not around from, which shares an original vertex, neither of from nor
+        // of to, with triangle.
+        [[nodiscard]] std::optional<std::uint32_t> findCornerOnSameSide(std::uint32_t triangle, std::uint32_t from, std::uint32_t to) const {
+            for (std::uint32_t shared : triangles[triangle]){
+                if (weld[shared] == from || weld[shared] == to){
+                    continue;
+                }
+
+                for (std::uint32_t neighbor : vertex_triangles[to]){
+                    const auto &corners = triangles[neighbor];
+                    if (!isAround(neighbor, to) || isAround(neighbor, from) || std::ranges::find(corners, shared) == corners.end()){
+                        continue;
+                    }
+                    return *std::ranges::find_if(corners, [&](std::uint32_t corner){ return weld[corner] == to; });
+                }
+            }
+            return std::nullopt;
+        }
+
+        /**
+         * @brief Map the original vertices of \p from to those of \p to on the same side of the attribute seams, so a
+         * vertex keeps the attributes of its side.
+         * @return Pairs of original vertices, or \p std::nullopt if an original vertex of \p from has no counterpart,
+         * i.e. the collapse would move a seam vertex off the seam.
+         */
+        [[nodiscard]] std::optional<std::vector<std::pair<std::uint32_t, std::uint32_t>>> getCornerRemap(std::uint32_t from, std::uint32_t to) const {
+            // Original vertices of from take the original vertex of to which shares a removed triangle with them.
+            std::vector<std::pair<std::uint32_t, std::uint32_t>> remap;
+            const auto is_remapped = [&](std::uint32_t corner){
+                return std::ranges::find(remap, corner, &std::pair<std::uint32_t, std::uint32_t>::first) != remap.end();
+            };
+            for (std::uint32_t triangle : vertex_triangles[from]){
+                if (!isAround(triangle, from) || !isAround(triangle, to)){
+                    continue;
+                }
+
+                const auto &corners = triangles[triangle];
+                const auto to_corner = std::ranges::find_if(corners, [&](std::uint32_t corner){ return weld[corner] == to; });
+                for (std::uint32_t corner : corners){
+                    if (weld[corner] == from && !is_remapped(corner)){
+                        remap.emplace_back(corner, *to_corner);
+                    }
+                }
+            }
+
+            // The others are on a side of a seam which no removed triangle touches, and take the original vertex of to
+            // in an adjacent triangle on the same side.
+            for (std::uint32_t triangle : vertex_triangles[from]){
+                if (!isAround(triangle, from)){
+                    continue;
+                }
+
+                for (std::uint32_t corner : triangles[triangle]){
+                    if (weld[corner] != from || is_remapped(corner)){
+                        continue;
+                    }
+
+                    const std::optional to_corner = findCornerOnSameSide(triangle, from, to);
+                    if (!to_corner){
+                        return std::nullopt;
+                    }
+                    remap.emplace_back(corner, *to_corner);
+                }
+            }
+            return remap;
+        }
+
+        void collapse(std::uint32_t from, std::uint32_t to, std::span<const std::pair<std::uint32_t, std::uint32_t>> remap){
+            for (std::uint32_t triangle : vertex_triangles[from]){
+                if (isAround(triangle, from) && isAround(triangle, to)){
+                    removed[triangle] = true;
+                    --triangle_count;
+                }
+            }
+
+            for (std::uint32_t triangle : vertex_triangles[from]){
+                if (!isAround(triangle, from)){
+                    continue;
+                }
+
+                for (std::uint32_t &corner : triangles[triangle]){
+                    if (weld[corner] == from){
+                        corner = std::ranges::find(remap, corner, &std::pair<std::uint32_t, std::uint32_t>::first)->second;
+                    }
+                }
+                vertex_triangles[to].push_back(triangle);
+            }
+
+            quadrics[to] += quadrics[from];
+            collapsed[from] = true;
+            vertex_triangles[from].clear();
+            vertex_triangles[from].shrink_to_fit();
+
+            std::erase_if(vertex_triangles[to], [&](std::uint32_t triangle){ return !isAround(triangle, to); });
+            std::ranges::sort(vertex_triangles[to]);
+            vertex_triangles[to].erase(std::ranges::unique(vertex_triangles[to]).begin(), vertex_triangles[to].end());
+
+            // The quadric of to has grown, so the costs of its edges have to.
+            for (std::uint32_t triangle : vertex_triangles[to]){
+                for (std::uint32_t corner : triangles[triangle]){
+                    if (const std::uint32_t neighbor = weld[corner]; neighbor != to){
+                        push(neighbor, to);
+                        push(to, neighbor);
+                    }
+                }
+            }
+        }
+
+    public:
+        Simplifier(std::span<const glm::vec3> positions, std::span<const std::uint32_t> indices) : positions { positions } {
+            std::unordered_map<glm::vec3, std::uint32_t, PositionHash, PositionEqual> welded_vertices;
+            weld.reserve(positions.size());
+            for (std::uint32_t vertex = 0; vertex < positions.size(); ++vertex){
+                const auto [it, inserted] = welded_vertices.try_emplace(positions[vertex], static_cast<std::uint32_t>(representatives.size()));
+                if (inserted){
+                    representatives.push_back(vertex);
+                }
+                weld.push_back(it->second);
+            }
+
+            const std::size_t welded_count = representatives.size();
+            quadrics.resize(welded_count);
+            collapsed.resize(welded_count);
+            vertex_triangles.resize(welded_count);
+
+            // Triangles degenerate after welding are dropped.
+            std::unordered_map<std::uint64_t, std::pair<std::uint32_t, std::uint32_t>> edge_triangles; // Welded edge -> (triangle count, triangle).
+            for (std::size_t i = 0; i < indices.size(); i += 3){
+                const std::array<std::uint32_t, 3> corners { indices[i], indices[i + 1], indices[i + 2] };
+                const std::array<std::uint32_t, 3> welded { weld[corners[0]], weld[corners[1]], weld[corners[2]] };
+                if (welded[0] == welded[1] || welded[1] == welded[2] || welded[2] == welded[0]){
+                    continue;
+                }
+
+                const auto triangle = static_cast<std::uint32_t>(triangles.size());
+                triangles.push_back(corners);
+                for (std::size_t j = 0; j < 3; ++j){
+                    vertex_triangles[welded[j]].push_back(triangle);
+
+                    const std::uint32_t a = welded[j], b = welded[(j + 1) % 3];
+                    auto &[count, edge_triangle] = edge_triangles[static_cast<std::uint64_t>(std::min(a, b)) << 32 | std::max(a, b)];
+                    ++count;
+                    edge_triangle = triangle;
+                }
+
+                const Vector p0 { positions[corners[0]] }, p1 { positions[corners[1]] }, p2 { positions[corners[2]] };
+                const Vector normal = (p1 - p0).cross(p2 - p0);
+                if (const double length = std::sqrt(normal.dot(normal)); length > 0.0){
+                    const Vector unit_normal { normal.x / length, normal.y / length, normal.z / length };
+                    const Quadric quadric = Quadric::fromPlane(unit_normal, -unit_normal.dot(p0), 1.0);
+                    for (std::uint32_t vertex : welded){
+                        quadrics[vertex] += quadric;
+                    }
+                }
+            }
+            removed.resize(triangles.size());
+            triangle_count = triangles.size();
+
+            // Edges of a single triangle are on an open boundary: constrain them by the plane through the edge
+            // perpendicular to the triangle.
+            for (const auto &[key, value] : edge_triangles){
+                const auto &[count, triangle] = value;
+                if (count != 1){
+                    continue;
+                }
+
+                const auto a = static_cast<std::uint32_t>(key >> 32), b = static_cast<std::uint32_t>(key);
+                const auto &corners = triangles[triangle];
+                const Vector p0 { positions[corners[0]] }, p1 { positions[corners[1]] }, p2 { positions[corners[2]] };
+                const Vector face_normal = (p1 - p0).cross(p2 - p0);
+                const Vector pa { getPosition(a) };
+                const Vector plane_normal = (Vector { getPosition(b) } - pa).cross(face_normal);
+                if (const double length = std::sqrt(plane_normal.dot(plane_normal)); length > 0.0){
+                    const Vector unit_normal { plane_normal.x / length, plane_normal.y / length, plane_normal.z / length };
+                    const Quadric quadric = Quadric::fromPlane(unit_normal, -unit_normal.dot(pa), boundary_weight);
+                    quadrics[a] += quadric;
+                    quadrics[b] += quadric;
+                }
+            }
+
+            for (const auto &[key, value] : edge_triangles){
+                const auto a = static_cast<std::uint32_t>(key >> 32), b = static_cast<std::uint32_t>(key);
+                push(a, b);
+                push(b, a);
+            }
+        }
+
+        /**
+         * @brief Collapse edges in ascending order of cost until at most \p target_triangle_count triangles are left.
+         * @return \p false if no more collapse is possible within \p max_error , \p true otherwise.
+         */
+        bool simplify(std::size_t target_triangle_count, double max_error){
+            const double max_error_cost = max_error * max_error;
+            while (triangle_count > target_triangle_count){
+                if (queue.empty()){
+                    return false;
+                }
+
+                const Collapse candidate = queue.top();
+                if (candidate.cost > max_error_cost){
+                    return false;
+                }
+                queue.pop();
+
+                if (collapsed[candidate.from] || collapsed[candidate.to]){
+                    continue;
+                }
+
+                // Stale cost: put it back with the current one.
+                if (const double cost = getCost(candidate.from, candidate.to); cost > candidate.cost){
+                    queue.push({ cost, candidate.from, candidate.to });
+                    continue;
+                }
+
+                if (!isCollapseValid(candidate.from, candidate.to)){
+                    continue;
+                }
+                const auto remap = getCornerRemap(candidate.from, candidate.to);
+                if (!remap){
+                    continue;
+                }
+
+                max_cost = std::max(max_cost, candidate.cost);
+                collapse(candidate.from, candidate.to, *remap);
+            }
+            return true;
+        }
+
+        void appendIndices(std::vector<std::uint32_t> &indices) const {
+            for (std::size_t triangle = 0; triangle < triangles.size(); ++triangle){
+                if (!removed[triangle]){
+                    indices.insert(indices.end(), triangles[triangle].begin(), triangles[triangle].end());
+                }
+            }
+        }
+
+        [[nodiscard]] std::size_t getTriangleCount() const noexcept {
+            return triangle_count;
+        }
+
+        [[nodiscard]] float getError() const noexcept {
+            return static_cast<float>(std::sqrt(max_cost));
+        }
+    };
+
+    std::uint32_t countVertices(std::span<const std::uint32_t> indices, std::size_t vertex_count){
+        std::vector<bool> referenced(vertex_count);
+        std::uint32_t count = 0;
+        for (std::uint32_t index : indices){
+            if (!referenced[index]){
+                referenced[index] = true;
+                ++count;
+            }
+        }
+        return count;
+    }
+}
+
+OpenGL::MeshLod::MeshLod(std::span<const glm::vec3> positions, std::span<const std::uint32_t> indices) : MeshLod { positions, indices, Options { } } {
+
+}
+
+OpenGL::MeshLod::MeshLod(std::span<const glm::vec3> positions, std::span<const std::uint32_t> indices, const Options &options) {
+    if (indices.size() % 3 != 0){
+        throw std::runtime_error { "Mesh indices must be a triangle list." };
+    }
+    if (std::ranges::any_of(indices, [&](std::uint32_t index){ return index >= positions.size(); })){
+        throw std::runtime_error { "Mesh index refers to a vertex out of the positions." };
+    }
+
+    glm::vec3 min { std::numeric_limits<float>::max() }, max { std::numeric_limits<float>::lowest() };
+    for (const glm::vec3 &position : positions){
+        min = glm::min(min, position);
+        max = glm::max(max, position);
+    }
+    bounding_center = positions.empty() ? glm::vec3 { 0.f } : (min + max) * 0.5f;
+    bounding_radius = 0.f;
+    for (const glm::vec3 &position : positions){
+        bounding_radius = std::max(bounding_radius, glm::distance(position, bounding_center));
+    }
+
+    this->indices.assign(indices.begin(), indices.end());
+    levels.push_back({ 0, static_cast<std::uint32_t>(indices.size()), countVertices(indices, positions.size()), 0.f });
+    if (options.max_level_count <= 1){
+        return;
+    }
+
+    Simplifier simplifier { positions, indices };
+    while (levels.size() < options.max_level_count){
+        const std::size_t previous_triangle_count = levels.back().index_count / 3;
+        const auto target_triangle_count = static_cast<std::size_t>(static_cast<float>(previous_triangle_count) * options.triangle_ratio);
+        if (target_triangle_count < options.min_triangle_count){
+            break;
+        }
+
+        const bool reached = simplifier.simplify(target_triangle_count, options.max_error);
+        if (simplifier.getTriangleCount() >= previous_triangle_count){
+            break;
+        }
+
+        const auto first_index = static_cast<std::uint32_t>(this->indices.size());
+        simplifier.appendIndices(this->indices);
+        const std::span<const std::uint32_t> level_indices = std::span { this->indices }.subspan(first_index);
+        levels.push_back({
+            first_index,
+            static_cast<std::uint32_t>(level_indices.size()),
+            countVertices(level_indices, positions.size()),
+            std::max(simplifier.getError(), levels.back().error),
+        });
+
+        if (!reached){
+            break;
+        }
+    }
+}
+
+std::span<const std::uint32_t> OpenGL::MeshLod::getIndices() const noexcept {
+    return indices;
+}
+
+std::span<const OpenGL::MeshLod::Level> OpenGL::MeshLod::getLevels() const noexcept {
+    return levels;
+}
+
+const OpenGL::MeshLod::Level &OpenGL::MeshLod::getLevel(std::size_t level) const noexcept {
+    return levels[level];
+}
+
+std::size_t OpenGL::MeshLod::getLevelCount() const noexcept {
+    return levels.size();
+}
+
+const glm::vec3 &OpenGL::MeshLod::getBoundingCenter() const noexcept {
+    return bounding_center;
+}
+
+float OpenGL::MeshLod::getBoundingRadius() const noexcept {
+    return bounding_radius;
+}
+
+OpenGL::LodSelector::LodSelector(float error_threshold) : error_threshold { error_threshold } {
+
+}
+
+void OpenGL::LodSelector::setProjection(const PerspectiveProjection &projection, float framebuffer_height) noexcept {
+    pixels_per_unit = framebuffer_height / (2.f * std::tan(projection.fov / 2.f));
+    near_distance = projection.near_distance;
+}
+
+void OpenGL::LodSelector::setErrorThreshold(float threshold) noexcept {
+    error_threshold = threshold;
+}
+
+float OpenGL::LodSelector::getErrorThreshold() const noexcept {
+    return error_threshold;
+}
+
+std::size_t OpenGL::LodSelector::select(const MeshLod &lod, float distance, float scale) {
+    // Nearest point of the bounding sphere, so that no part of the object gets a larger error than the projected one.
+    const float nearest_distance = std::max(distance - lod.getBoundingRadius() * scale, near_distance);
+    const float pixels_per_error = scale * pixels_per_unit / nearest_distance;
+
+    const std::span<const MeshLod::Level> levels = lod.getLevels();
+    std::size_t selected = 0;
+    for (std::size_t level = levels.size(); level-- > 1;){
+        if (levels[level].error * pixels_per_error <= error_threshold){
+            selected = level;
+            break;
+        }
+    }
+
+    if (statistics.size() < levels.size()){
+        statistics.resize(levels.size());
+    }
+    LevelStatistics &level_statistics = statistics[selected];
+    ++level_statistics.object_count;
+    level_statistics.triangle_count += levels[selected].index_count / 3;
+    level_statistics.vertex_count += levels[selected].vertex_count;
+
+    return selected;
+}
+
+std::size_t OpenGL::LodSelector::select(const MeshLod &lod, const glm::mat4 &model, const glm::vec3 &camera_position) {
+    const glm::vec3 center { model * glm::vec4 { lod.getBoundingCenter(), 1.f } };
+    const float scale = std::max({ glm::length(glm::vec3 { model[0] }), glm::length(glm::vec3 { model[1] }), glm::length(glm::vec3 { model[2] }) });
+    return select(lod, glm::distance(center, camera_position), scale);
+}
+
+void OpenGL::LodSelector::beginFrame() noexcept {
+    std::ranges::fill(statistics, LevelStatistics { });
+}
+
+std::span<const OpenGL::LodSelector::LevelStatistics> OpenGL::LodSelector::getStatistics() const noexcept {
+    return statistics;
+}
@@ -0,0 +1,392 @@
+//
+// Created by gomkyung2 on 2026/10/19.
+//
+
+#include "OpenGLApp/MipChain.hpp"
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cassert>
+#include <cmath>
+#include <fstream>
+#include <numbers>
+#include <stdexcept>
+
+#include "OpenGLApp/Capabilities.hpp"
+#include "OpenGLApp/GLInterceptCore.hpp"
+
+#if defined(__SSE__) || defined(_M_X64)
+#define OPENGLAPP_MIP_CHAIN_SSE
+#include <xmmintrin.h>
+#endif
+
+namespace{
+    constexpr std::size_t tile_rows = 32;
+    constexpr std::size_t encode_table_size = 4096;
+    constexpr std::array<char, 8> cache_magic { 'O', 'G', 'L', 'M', 'I', 'P', 'S', '1' };
+    constexpr std::array<GLenum, 4> formats { GL_RED, GL_RG, GL_RGB, GL_RGBA };
+
+    // Written as is, so it must be value-initialized to zero its padding bytes.
+    struct CacheHeader{
+        std::array<char, 8> magic;
+        std::int64_t source_time;
+        std::int32_t width, height, channels, level_count;
+        OpenGL::MipChain::Options options;
+    };
+
+    // Separable downsampling kernel. Output pixel x takes source pixels 2x + offsets[i] with weights[i].
+    struct Kernel{
+        std::size_t tap_count;
+        std::array<int, 6> offsets;
+        std::array<float, 6> weights;
+    };
+
+    // Zeroth order modified Bessel function of the first kind, for the Kaiser window.
+    double besselI0(double x) noexcept {
+        double sum = 1.0, term = 1.0;
+        for (int k = 1; k < 32; ++k){
+            term *= (x / (2 * k)) * (x / (2 * k));
+            sum += term;
+        }
+        return sum;
+    }
+
+    Kernel makeKernel(OpenGL::MipChain::Filter filter) noexcept {
+        if (filter == OpenGL::MipChain::Filter::Box){
+            return { 2, { 0, 1 }, { 0.5f, 0.5f } };
+        }
+
+        // Windowed sinc with cutoff at the destination Nyquist frequency, 3 source pixels wide on each side.
+        constexpr double radius = 3.0, beta = 4.0;
+        Kernel kernel { 6, { -2, -1, 0, 1, 2, 3 }, {} };
+        double weight_sum = 0.0;
+        std::array<double, 6> weights;
+        for (std::size_t tap = 0; tap < kernel.tap_count; ++tap){
+            const double distance = kernel.offsets[tap] - 0.5; // From the center of the output pixel, in source pixels.
+            const double t = distance / 2.0;
+            const double sinc = std::sin(std::numbers::pi * t) / (std::numbers::pi * t);
+            const double window = besselI0(beta * std::sqrt(1.0 - (distance / radius) * (distance / radius))) / besselI0(beta);
+            weights[tap] = sinc * window;
+            weight_sum += weights[tap];
+        }
+        for (std::size_t tap = 0; tap < kernel.tap_count; ++tap){
+            kernel.weights[tap] = static_cast<float>(weights[tap] / weight_sum);
+        }
+        return kernel;
+    }
+
+    const std::array<float, 256> &getDecodeTable() {
+        static const std::array table = []{
+            std::array<float, 256> table;
+            for (std::size_t index = 0; index < table.size(); ++index){
+                const float value = static_cast<float>(index) / 255.f;
+                table[index] = value <= 0.04045f ? value / 12.92f : std::pow((value + 0.055f) / 1.055f, 2.4f);
+            }
+            return table;
+        }();
+        return table;
+    }
+
+    const std::array<unsigned char, encode_table_size> &getEncodeTable() {
+        static const std::array table = []{
+            std::array<unsigned char, encode_table_size> table;
+            for (std::size_t index = 0; index < table.size(); ++index){
+                const float value = static_cast<float>(index) / (encode_table_size - 1);
+                const float encoded = value <= 0.0031308f ? value * 12.92f : 1.055f * std::pow(value, 1.f / 2.4f) - 0.055f;
+                table[index] = static_cast<unsigned char>(encoded * 255.f + 0.5f);
+            }
+            return table;
+        }();
+        return table;
+    }
+
+    // Number of leading channels which are sRGB-encoded in sRGB images; the rest is alpha.
+    int getColorChannels(int channels) noexcept {
+        return channels == 2 || channels == 4 ? channels - 1 : channels;
+    }
+
+    void decode(const unsigned char *source, float *destination, std::size_t pixel_count, int channels, bool srgb) {
+        const std::array<float, 256> &table = getDecodeTable();
+        const int color_channels = srgb ? getColorChannels(channels) : 0;
+        for (std::size_t pixel = 0; pixel < pixel_count; ++pixel){
+            for (int channel = 0; channel < channels; ++channel){
+                const unsigned char value = *source++;
+                *destination++ = channel < color_channels ? table[value] : static_cast<float>(value) * (1.f / 255.f);
+            }
+        }
+    }
+
+    void encode(const float *source, unsigned char *destination, std::size_t pixel_count, int channels, bool srgb) {
+        const std::array<unsigned char, encode_table_size> &table = getEncodeTable();
+        const int color_channels = srgb ? getColorChannels(channels) : 0;
+        for (std::size_t pixel = 0; pixel < pixel_count; ++pixel){
+            for (int channel = 0; channel < channels; ++channel){
+                const float value = std::clamp(*source++, 0.f, 1.f);
+                *destination++ = channel < color_channels
+                    ? table[static_cast<std::size_t>(value * (encode_table_size - 1) + 0.5f)]
+                    : static_cast<unsigned char>(value * 255.f + 0.5f);
+            }
+        }
+    }
+
+    // destination[i] += weight * source[i].
+    void addScaled(float *destination, const float *source, float weight, std::size_t count) noexcept {
+        std::size_t index = 0;
+#ifdef OPENGLAPP_MIP_CHAIN_SSE
+        const __m128 weight4 = _mm_set1_ps(weight);
+        for (; index + 4 <= count; index += 4){
+            _mm_storeu_ps(destination + index, _mm_add_ps(_mm_loadu_ps(destination + index), _mm_mul_ps(weight4, _mm_loadu_ps(source + index))));
+        }
+#endif
+        for (; index < count; ++index){
+            destination[index] += weight * source[index];
+        }
+    }
+
+    void downsampleRow(const float *source, int source_width, float *destination, int destination_width, int channels, const Kernel &kernel) noexcept {
+#ifdef OPENGLAPP_MIP_CHAIN_SSE
+        if (channels == 4){
+            // A pixel fits in a register.
+            for (int x = 0; x < destination_width; ++x){
+                __m128 sum = _mm_setzero_ps();
+                for (std::size_t tap = 0; tap < kernel.tap_count; ++tap){
+                    const int source_x = std::clamp(2 * x + kernel.offsets[tap], 0, source_width - 1);
+                    sum = _mm_add_ps(sum, _mm_mul_ps(_mm_set1_ps(kernel.weights[tap]), _mm_loadu_ps(source + 4 * source_x)));
+                }
+                _mm_storeu_ps(destination + 4 * x, sum);
+            }
+            return;
+        }
+#endif
+        for (int x = 0; x < destination_width; ++x){
+            float *out = destination + channels * x;
+            std::fill_n(out, channels, 0.f);
+            for (std::size_t tap = 0; tap < kernel.tap_count; ++tap){
+                const int source_x = std::clamp(2 * x + kernel.offsets[tap], 0, source_width - 1);
+                for (int channel = 0; channel < channels; ++channel){
+                    out[channel] += kernel.weights[tap] * source[channels * source_x + channel];
+                }
+            }
+        }
+    }
+
+    OpenGL::MipChain::ColorSpace getColorSpace(const OpenGL::Utils::Image &image) noexcept {
+        return image.getColorSpace() == OpenGL::Utils::Image::ColorSpace::Srgb ? OpenGL::MipChain::ColorSpace::Srgb : OpenGL::MipChain::ColorSpace::Linear;
+    }
+
+    const OpenGL::Utils::Image &checkColorSpace(const OpenGL::Utils::Image &image, OpenGL::MipChain::ColorSpace color_space) {
+        if (getColorSpace(image) != color_space){
+            throw std::runtime_error { "Color space of the mip chain differs from the color space of the image." };
+        }
+        return image;
+    }
+
+    std::size_t getTileCount(int rows) noexcept {
+        return (static_cast<std::size_t>(rows) + tile_rows - 1) / tile_rows;
+    }
+
+    // Levels from width x height down to 1x1.
+    std::int32_t getLevelCount(int width, int height) noexcept {
+        return static_cast<std::int32_t>(std::bit_width(static_cast<unsigned int>(std::max(width, height))));
+    }
+
+    // Whether the cache header describes the mip chain of the source image, so that its level sizes can be trusted.
+    bool isValid(const CacheHeader &header, const OpenGL::Utils::Image::Info &source_info) noexcept {
+        return header.channels == source_info.channels && header.channels >= 1 && header.channels <= 4
+            && header.width == source_info.width && header.height == source_info.height && header.width > 0 && header.height > 0
+            && header.level_count == getLevelCount(header.width, header.height);
+    }
+}
+
+OpenGL::MipChain::MipChain(int channels, Options options, std::vector<Level> levels) noexcept
+        : channels { channels }, format { formats[channels - 1] }, options { options }, levels { std::move(levels) } {
+
+}
+
+std::filesystem::path OpenGL::MipChain::getCachePath(const std::filesystem::path &filename) {
+    return std::filesystem::path { filename } += ".mips";
+}
+
+OpenGL::MipChain::MipChain(int width, int height, int channels, const unsigned char *data, Options options, Utils::ThreadPool &thread_pool)
+        : channels { channels }, options { options } {
+    if (channels < 1 || channels > 4){
+        throw std::runtime_error { "Unsupported image channel count." };
+    }
+    format = formats[channels - 1];
+
+    const bool srgb = options.color_space == ColorSpace::Srgb;
+    const Kernel kernel = makeKernel(options.filter);
+
+    levels.push_back({ width, height, std::vector<unsigned char>(data, data + static_cast<std::size_t>(width) * height * channels) });
+
+    // Filtering is done in linear float, and each level is encoded as it is produced.
+    std::vector<float> current(static_cast<std::size_t>(width) * height * channels);
+    thread_pool.parallelFor(getTileCount(height), [&](std::size_t tile){
+        const std::size_t row_begin = tile * tile_rows, row_end = std::min(row_begin + tile_rows, static_cast<std::size_t>(height));
+        const std::size_t row_size = static_cast<std::size_t>(width) * channels;
+        decode(data + row_begin * row_size, current.data() + row_begin * row_size, (row_end - row_begin) * width, channels, srgb);
+    });
+
+    std::vector<float> horizontal, next;
+    while (width > 1 || height > 1){
+        const int next_width = std::max(width / 2, 1), next_height = std::max(height / 2, 1);
+        const std::size_t source_row_size = static_cast<std::size_t>(width) * channels;
+        const std::size_t row_size = static_cast<std::size_t>(next_width) * channels;
+
+        // Horizontal pass: width x height -> next_width x height.
+        horizontal.resize(row_size * height);
+        thread_pool.parallelFor(getTileCount(height), [&](std::size_t tile){
+            const std::size_t row_begin = tile * tile_rows, row_end = std::min(row_begin + tile_rows, static_cast<std::size_t>(height));
+            for (std::size_t y = row_begin; y < row_end; ++y){
+                downsampleRow(current.data() + y * source_row_size, width, horizontal.data() + y * row_size, next_width, channels, kernel);
+            }
+        });
+
+        // Vertical pass: next_width x height -> next_width x next_height, then encode.
+        Level &level = levels.emplace_back(next_width, next_height, std::vector<unsigned char>(row_size * next_height));
+        next.assign(row_size * next_height, 0.f);
+        thread_pool.parallelFor(getTileCount(next_height), [&](std::size_t tile){
+            const std::size_t row_begin = tile * tile_rows, row_end = std::min(row_begin + tile_rows, static_cast<std::size_t>(next_height));
+            for (std::size_t y = row_begin; y < row_end; ++y){
+                float *out = next.data() + y * row_size;
+                for (std::size_t tap = 0; tap < kernel.tap_count; ++tap){
+                    const int source_y = std::clamp(2 * static_cast<int>(y) + kernel.offsets[tap], 0, height - 1);
+                    addScaled(out, horizontal.data() + source_y * row_size, kernel.weights[tap], row_size);
+                }
+            }
+            encode(next.data() + row_begin * row_size, level.pixels.data() + row_begin * row_size, (row_end - row_begin) * next_width, channels, srgb);
+        });
+
+        std::swap(current, next);
+        width = next_width;
+        height = next_height;
+    }
+}
+
+OpenGL::MipChain::MipChain(const Utils::Image &image, Filter filter, Utils::ThreadPool &thread_pool)
+        : MipChain { image, Options { filter, getColorSpace(image) }, thread_pool } {
+
+}
+
+OpenGL::MipChain::MipChain(const Utils::Image &image, Options options, Utils::ThreadPool &thread_pool)
+        : MipChain { image.getWidth(), image.getHeight(), image.getChannels(), checkColorSpace(image, options.color_space).getData(), options, thread_pool } {
+    format = image.getGLFormat().format;
+}
+
+OpenGL::MipChain OpenGL::MipChain::load(const char *filename, Options options) {
+    const std::filesystem::file_time_type source_time = std::filesystem::last_write_time(filename);
+    const std::filesystem::path cache_path = getCachePath(filename);
+
+    if (std::ifstream file { cache_path, std::ios::binary }){
+        CacheHeader header {};
+        file.read(reinterpret_cast<char*>(&header), sizeof(header));
+        if (file && header.magic == cache_magic && header.source_time == source_time.time_since_epoch().count() && header.options == options
+            && isValid(header, Utils::Image::readInfo(filename))){
+            std::vector<Level> levels;
+            int width = header.width, height = header.height;
+            for (std::int32_t level = 0; level < header.level_count; ++level){
+                std::vector<unsigned char> pixels(static_cast<std::size_t>(width) * height * header.channels);
+                file.read(reinterpret_cast<char*>(pixels.data()), static_cast<std::streamsize>(pixels.size()));
+                levels.emplace_back(width, height, std::move(pixels));
+                width = std::max(width / 2, 1);
+                height = std::max(height / 2, 1);
+            }
+            if (file){
+                return { header.channels, options, std::move(levels) };
+            }
+        }
+    }
+
+    const Utils::Image::ColorSpace color_space = options.color_space == ColorSpace::Srgb ? Utils::Image::ColorSpace::Srgb : Utils::Image::ColorSpace::Linear;
+    MipChain mip_chain { Utils::Image { filename, { .color_space = color_space } }, options };
+    mip_chain.save(cache_path, source_time);
+    return mip_chain;
+}
+
+bool OpenGL::MipChain::save(const std::filesystem::path &filename, std::filesystem::file_time_type source_time) const {
+    std::ofstream file { filename, std::ios::binary };
+    if (!file){
+        return false;
+    }
+
+    CacheHeader header {};
+    header.magic = cache_magic;
+    header.source_time = source_time.time_since_epoch().count();
+    header.width = levels.front().width;
+    header.height = levels.front().height;
+    header.channels = channels;
+    header.level_count = static_cast<std::int32_t>(levels.size());
+    header.options = options;
+    file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    for (const Level &level : levels){
+        file.write(reinterpret_cast<const char*>(level.pixels.data()), static_cast<std::streamsize>(level.pixels.size()));
+    }
+    return static_cast<bool>(file);
+}
+
+GLuint OpenGL::MipChain::createTexture(GLenum internal_format) const {
+    if (internal_format == GL_NONE){
+        internal_format = getInternalFormat();
+    }
+    const auto level_count = static_cast<GLsizei>(levels.size());
+
+    GLint previous_unpack_alignment;
+    glGetIntegerv(GL_UNPACK_ALIGNMENT, &previous_unpack_alignment);
+    glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+
+    GLuint handle;
+    const Capabilities &capabilities = Capabilities::get();
+    if (capabilities.direct_state_access){
+        glCreateTextures(GL_TEXTURE_2D, 1, &handle);
+        glTextureStorage2D(handle, level_count, internal_format, levels.front().width, levels.front().height);
+        for (GLint level = 0; level < level_count; ++level){
+            glTextureSubImage2D(handle, level, 0, 0, levels[level].width, levels[level].height, format, GL_UNSIGNED_BYTE, levels[level].pixels.data());
+        }
+        glTextureParameteri(handle, GL_TEXTURE_MIN_FILTER, GL_LINEAR_MIPMAP_LINEAR);
+        glTextureParameteri(handle, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+
+        glPixelStorei(GL_UNPACK_ALIGNMENT, previous_unpack_alignment);
+        return handle;
+    }
+
+    glGenTextures(1, &handle);
+    glBindTexture(GL_TEXTURE_2D, handle);
+
+    if (capabilities.texture_storage){
+        glTexStorage2D(GL_TEXTURE_2D, level_count, internal_format, levels.front().width, levels.front().height);
+        for (GLint level = 0; level < level_count; ++level){
+            glTexSubImage2D(GL_TEXTURE_2D, level, 0, 0, levels[level].width, levels[level].height, format, GL_UNSIGNED_BYTE, levels[level].pixels.data());
+        }
+    }
+    else{
+        for (GLint level = 0; level < level_count; ++level){
+            glTexImage2D(GL_TEXTURE_2D, level, static_cast<GLint>(internal_format), levels[level].width, levels[level].height, 0, format, GL_UNSIGNED_BYTE, levels[level].pixels.data());
+        }
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAX_LEVEL, level_count - 1);
+    }
+
+    glPixelStorei(GL_UNPACK_ALIGNMENT, previous_unpack_alignment);
+
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR_MIPMAP_LINEAR);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+    return handle;
+}
+
+int OpenGL::MipChain::getChannels() const noexcept {
+    return channels;
+}
+
+std::span<const OpenGL::MipChain::Level> OpenGL::MipChain::getLevels() const noexcept {
+    return levels;
+}
+
+GLenum OpenGL::MipChain::getFormat() const noexcept {
+    return format;
+}
+
+GLenum OpenGL::MipChain::getInternalFormat() const noexcept {
+    const bool srgb = options.color_space == ColorSpace::Srgb;
+    constexpr std::array<GLenum, 4> linear_formats { GL_R8, GL_RG8, GL_RGB8, GL_RGBA8 };
+    return srgb && channels == 3 ? GL_SRGB8 : srgb && channels == 4 ? GL_SRGB8_ALPHA8 : linear_formats[channels - 1];
+}
@@ -6,14 +6,29 @@
 
 #include <fstream>
 #include <algorithm>
+#include <array>
+#include <chrono>
+#include <initializer_list>
+#include <string>
+
+#include "OpenGLApp/Capabilities.hpp"
 
 namespace{
-    GLuint createProgram(const OpenGL::Shader &vertex_shader, const OpenGL::Shader &fragment_shader) {
+    OpenGL::Program::Statistics statistics {};
+
+    GLuint createProgram(std::initializer_list<GLuint> shaders, bool separable) {
         const GLuint handle = glCreateProgram();
-        glAttachShader(handle, vertex_shader.handle);
-        glAttachShader(handle, fragment_shader.handle);
+        if (separable){
+            glProgramParameteri(handle, GL_PROGRAM_SEPARABLE, GL_TRUE);
+        }
+        for (GLuint shader : shaders){
+            glAttachShader(handle, shader);
+        }
 
+        const auto link_start = std::chrono::steady_clock::now();
         glLinkProgram(handle);
+        statistics.link_time += std::chrono::duration<double> { std::chrono::steady_clock::now() - link_start }.count();
+        ++statistics.link_count;
 
 #ifndef NDEBUG
         static GLint success;
@@ -28,33 +43,311 @@ namespace{
 
         return handle;
     }
+
+    GLbitfield getShaderStage(const OpenGL::Shader &shader) {
+        GLint type;
+        glGetShaderiv(shader.handle, GL_SHADER_TYPE, &type);
+        switch (type){
+            case GL_VERTEX_SHADER: return GL_VERTEX_SHADER_BIT;
+            case GL_TESS_CONTROL_SHADER: return GL_TESS_CONTROL_SHADER_BIT;
+            case GL_TESS_EVALUATION_SHADER: return GL_TESS_EVALUATION_SHADER_BIT;
+            case GL_GEOMETRY_SHADER: return GL_GEOMETRY_SHADER_BIT;
+            case GL_FRAGMENT_SHADER: return GL_FRAGMENT_SHADER_BIT;
+            case GL_COMPUTE_SHADER:
+                throw std::runtime_error { "Compute shaders cannot be a stage of a program pipeline." };
+            default:
+                throw std::runtime_error { "Unknown shader type of a separable program." };
+        }
+    }
+
+    GLuint createSeparableProgram(const OpenGL::Shader &shader) {
+        if (!OpenGL::Capabilities::get().separate_shader_objects){
+            throw std::runtime_error { "Separable programs require GL 4.1 or ARB_separate_shader_objects." };
+        }
+        getShaderStage(shader); // Reject the shaders which cannot be a pipeline stage before creating the program.
+        return createProgram({ shader.handle }, true);
+    }
+
+    /**
+     * @brief Copy the value of the uniform \p name from \p source_program to the currently used \p target_program .
+     * @param source_program Program to read the uniform value.
+     * @param target_program Program to write the uniform value, which must be in use.
+     * @param name Name of the uniform (for arrays, name of the element e.g. "lights[2].position").
+     * @param type Type of the uniform, which is given by glGetActiveUniform.
+     */
+    void copyUniformValue(GLuint source_program, GLuint target_program, const char *name, GLenum type){
+        const GLint source_location = glGetUniformLocation(source_program, name);
+        const GLint target_location = glGetUniformLocation(target_program, name);
+        if (source_location == -1 || target_location == -1){
+            return;
+        }
+
+        std::array<GLfloat, 16> float_values;
+        std::array<GLint, 4> int_values;
+        std::array<GLuint, 4> uint_values;
+        switch (type){
+            case GL_FLOAT:             glGetUniformfv(source_program, source_location, float_values.data()); glUniform1fv(target_location, 1, float_values.data()); break;
+            case GL_FLOAT_VEC2:        glGetUniformfv(source_program, source_location, float_values.data()); glUniform2fv(target_location, 1, float_values.data()); break;
+            case GL_FLOAT_VEC3:        glGetUniformfv(source_program, source_location, float_values.data()); glUniform3fv(target_location, 1, float_values.data()); break;
+            case GL_FLOAT_VEC4:        glGetUniformfv(source_program, source_location, float_values.data()); glUniform4fv(target_location, 1, float_values.data()); break;
+            case GL_FLOAT_MAT2:        glGetUniformfv(source_program, source_location, float_values.data()); glUniformMatrix2fv(target_location, 1, GL_FALSE, float_values.data()); break;
+            case GL_FLOAT_MAT3:        glGetUniformfv(source_program, source_location, float_values.data()); glUniformMatrix3fv(target_location, 1, GL_FALSE, float_values.data()); break;
+            case GL_FLOAT_MAT4:        glGetUniformfv(source_program, source_location, float_values.data()); glUniformMatrix4fv(target_location, 1, GL_FALSE, float_values.data()); break;
+            case GL_FLOAT_MAT2x3:      glGetUniformfv(source_program, source_location, float_values.data()); glUniformMatrix2x3fv(target_location, 1, GL_FALSE, float_values.data()); break;
+            case GL_FLOAT_MAT2x4:      glGetUniformfv(source_program, source_location, float_values.data()); glUniformMatrix2x4fv(target_location, 1, GL_FALSE, float_values.data()); break;
+            case GL_FLOAT_MAT3x2:      glGetUniformfv(source_program, source_location, float_values.data()); glUniformMatrix3x2fv(target_location, 1, GL_FALSE, float_values.data()); break;
+            case GL_FLOAT_MAT3x4:      glGetUniformfv(source_program, source_location, float_values.data()); glUniformMatrix3x4fv(target_location, 1, GL_FALSE, float_values.data()); break;
+            case GL_FLOAT_MAT4x2:      glGetUniformfv(source_program, source_location, float_values.data()); glUniformMatrix4x2fv(target_location, 1, GL_FALSE, float_values.data()); break;
+            case GL_FLOAT_MAT4x3:      glGetUniformfv(source_program, source_location, float_values.data()); glUniformMatrix4x3fv(target_location, 1, GL_FALSE, float_values.data()); break;
+            case GL_INT: case GL_BOOL: glGetUniformiv(source_program, source_location, int_values.data()); glUniform1iv(target_location, 1, int_values.data()); break;
+            case GL_INT_VEC2: case GL_BOOL_VEC2: glGetUniformiv(source_program, source_location, int_values.data()); glUniform2iv(target_location, 1, int_values.data()); break;
+            case GL_INT_VEC3: case GL_BOOL_VEC3: glGetUniformiv(source_program, source_location, int_values.data()); glUniform3iv(target_location, 1, int_values.data()); break;
+            case GL_INT_VEC4: case GL_BOOL_VEC4: glGetUniformiv(source_program, source_location, int_values.data()); glUniform4iv(target_location, 1, int_values.data()); break;
+            case GL_UNSIGNED_INT:      glGetUniformuiv(source_program, source_location, uint_values.data()); glUniform1uiv(target_location, 1, uint_values.data()); break;
+            case GL_UNSIGNED_INT_VEC2: glGetUniformuiv(source_program, source_location, uint_values.data()); glUniform2uiv(target_location, 1, uint_values.data()); break;
+            case GL_UNSIGNED_INT_VEC3: glGetUniformuiv(source_program, source_location, uint_values.data()); glUniform3uiv(target_location, 1, uint_values.data()); break;
+            case GL_UNSIGNED_INT_VEC4: glGetUniformuiv(source_program, source_location, uint_values.data()); glUniform4uiv(target_location, 1, uint_values.data()); break;
+            default:
+                // Remaining types are samplers and images, whose value is a texture unit.
+                glGetUniformiv(source_program, source_location, int_values.data());
+                glUniform1iv(target_location, 1, int_values.data());
+                break;
+        }
+    }
+
+    /**
+     * @brief Copy the values of every active uniform in \p source_program to the currently used \p target_program .
+     * @param source_program Program to read the uniform values.
+     * @param target_program Program to write the uniform values, which must be in use.
+     */
+    void copyUniformValues(GLuint source_program, GLuint target_program){
+        GLint uniform_count, max_name_length;
+        glGetProgramiv(source_program, GL_ACTIVE_UNIFORMS, &uniform_count);
+        glGetProgramiv(source_program, GL_ACTIVE_UNIFORM_MAX_LENGTH, &max_name_length);
+
+        std::string name(max_name_length, '\0');
+        for (GLuint index = 0; index < static_cast<GLuint>(uniform_count); ++index){
+            GLsizei name_length;
+            GLint size;
+            GLenum type;
+            glGetActiveUniform(source_program, index, max_name_length, &name_length, &size, &type, name.data());
+
+            std::string_view uniform_name { name.data(), static_cast<std::size_t>(name_length) };
+            if (size == 1){
+                copyUniformValue(source_program, target_program, std::string { uniform_name }.c_str(), type);
+                continue;
+            }
+
+            // Array uniform: the name is reported as "name[0]", and each element has its own location.
+            if (uniform_name.ends_with("[0]")){
+                uniform_name.remove_suffix(3);
+            }
+            for (GLint element = 0; element < size; ++element){
+                const std::string element_name = std::string { uniform_name } + '[' + std::to_string(element) + ']';
+                copyUniformValue(source_program, target_program, element_name.c_str(), type);
+            }
+        }
+    }
+
+    /**
+     * @brief Copy the binding points of every active uniform block in \p source_program to \p target_program by their
+     * names.
+     * @param source_program Program to read the uniform block bindings.
+     * @param target_program Program to write the uniform block bindings.
+     */
+    void copyUniformBlockBindings(GLuint source_program, GLuint target_program){
+        GLint block_count, max_name_length;
+        glGetProgramiv(source_program, GL_ACTIVE_UNIFORM_BLOCKS, &block_count);
+        glGetProgramiv(source_program, GL_ACTIVE_UNIFORM_BLOCK_MAX_NAME_LENGTH, &max_name_length);
+
+        std::string name(max_name_length, '\0');
+        for (GLuint index = 0; index < static_cast<GLuint>(block_count); ++index){
+            GLsizei name_length;
+            glGetActiveUniformBlockName(source_program, index, max_name_length, &name_length, name.data());
+            GLint binding;
+            glGetActiveUniformBlockiv(source_program, index, GL_UNIFORM_BLOCK_BINDING, &binding);
+
+            const std::string block_name { name.data(), static_cast<std::size_t>(name_length) };
+            if (const GLuint target_index = glGetUniformBlockIndex(target_program, block_name.c_str()); target_index != GL_INVALID_INDEX){
+                glUniformBlockBinding(target_program, target_index, static_cast<GLuint>(binding));
+            }
+        }
+    }
 }
 
 OpenGL::Program::Program(const std::filesystem::path &vertex_shader_path, const std::filesystem::path &fragment_shader_path)
-        : handle { createProgram(OpenGL::Shader::fromFile(GL_VERTEX_SHADER, vertex_shader_path),
-                                 OpenGL::Shader::fromFile(GL_FRAGMENT_SHADER, fragment_shader_path)) }
+        : Program { OpenGL::Shader::fromFile(GL_VERTEX_SHADER, vertex_shader_path),
+                    OpenGL::Shader::fromFile(GL_FRAGMENT_SHADER, fragment_shader_path) }
 {
 
 }
 
 OpenGL::Program::Program(const Shader &vertex_shader, const Shader &fragment_shader)
-        : handle { createProgram(vertex_shader, fragment_shader) }
+        : handle { createProgram({ vertex_shader.handle, fragment_shader.handle }, false) },
+          stages { GL_VERTEX_SHADER_BIT | GL_FRAGMENT_SHADER_BIT },
+          separable { false }
 {
+    reflect();
+    ++statistics.program_count;
+}
 
+OpenGL::Program::Program(const Shader &shader)
+        : handle { createSeparableProgram(shader) },
+          stages { getShaderStage(shader) },
+          separable { true }
+{
+    reflect();
+    ++statistics.program_count;
+    ++statistics.separable_program_count;
 }
 
 OpenGL::Program::~Program() noexcept {
     glDeleteProgram(handle);
+    --statistics.program_count;
+    if (separable){
+        --statistics.separable_program_count;
+    }
 }
 
-GLint OpenGL::Program::getUniformLocation(std::string_view name) const {
+GLuint OpenGL::Program::getHandle() const noexcept {
+    return handle;
+}
+
+GLbitfield OpenGL::Program::getStages() const noexcept {
+    return stages;
+}
+
+bool OpenGL::Program::isSeparable() const noexcept {
+    return separable;
+}
+
+void OpenGL::Program::replace(GLuint new_handle) {
+    const auto previous_program = State::getProgram();
+
+    // Apply the pending uniforms to the old program first, so that it has every value set so far. Then copy the values
+    // into the new program, which must be used to set the uniforms.
+    State::flushPendingUniforms(handle);
+    State::setProgram(new_handle);
+    copyUniformValues(handle, new_handle);
+    copyUniformBlockBindings(handle, new_handle);
+    if (previous_program.has_value() && previous_program.value() != handle){
+        State::setProgram(previous_program.value());
+    }
+    State::replaceProgram(handle, new_handle);
+
+    glDeleteProgram(handle);
+    handle = new_handle;
+
+    // Uniform locations may be changed in the new program, so they are looked up again on demand.
+    reflect();
+    uniform_locations.clear();
+    inactive_uniform_names.clear();
+}
+
+void OpenGL::Program::reflect() {
+    const auto query = [this](GLenum count_name, GLenum max_length_name, auto get_active, auto get_location){
+        GLint count, max_name_length;
+        glGetProgramiv(handle, count_name, &count);
+        glGetProgramiv(handle, max_length_name, &max_name_length);
+
+        std::vector<ActiveVariable> variables;
+        variables.reserve(count);
+
+        std::string name(max_name_length, '\0');
+        for (GLuint index = 0; index < static_cast<GLuint>(count); ++index){
+            GLsizei name_length;
+            GLint size;
+            GLenum type;
+            get_active(handle, index, max_name_length, &name_length, &size, &type, name.data());
+
+            std::string variable_name { name.data(), static_cast<std::size_t>(name_length) };
+            const GLint location = get_location(handle, variable_name.c_str());
+            variables.emplace_back(std::move(variable_name), location, type, size);
+        }
+        return variables;
+    };
+
+    active_uniforms = query(GL_ACTIVE_UNIFORMS, GL_ACTIVE_UNIFORM_MAX_LENGTH, glGetActiveUniform, glGetUniformLocation);
+    active_attributes = query(GL_ACTIVE_ATTRIBUTES, GL_ACTIVE_ATTRIBUTE_MAX_LENGTH, glGetActiveAttrib, glGetAttribLocation);
+}
+
+const OpenGL::Program::UniformLookup &OpenGL::Program::findUniform(std::string_view name) const {
     auto it = std::ranges::find(uniform_locations, name, [](const auto &pair) { return pair.first; });
-    if (it == uniform_locations.cend()){
-        std::string name_string { name };
-        GLint location = glGetUniformLocation(handle, name_string.c_str());
-        return uniform_locations.emplace_back(std::move(name_string), location).second;
+    if (it != uniform_locations.cend()){
+        return it->second;
+    }
+
+    // Non-array uniforms and the first element of arrays are found in the reflection.
+    // Arrays, including the ones of a single element, are reported as "name[0]", but they can be referred without the
+    // subscript.
+    auto active_it = std::ranges::find_if(active_uniforms, [name](const ActiveVariable &uniform){
+        return uniform.name == name || (uniform.name.size() == name.size() + 3 && uniform.name.starts_with(name) && uniform.name.ends_with("[0]"));
+    });
+
+    std::string name_string { name };
+    UniformLookup lookup { -1, GL_NONE };
+    if (active_it != active_uniforms.end()){
+        lookup = { active_it->location, active_it->type };
+    }
+    else if (const auto subscript_pos = name.rfind('['); subscript_pos != std::string_view::npos && name.ends_with(']')){
+        // Other array elements, e.g. "weights[3]": type is same as the first element.
+        const std::string first_element_name = std::string { name.substr(0, subscript_pos) } + "[0]";
+        active_it = std::ranges::find(active_uniforms, first_element_name, &ActiveVariable::name);
+        if (active_it != active_uniforms.end()){
+            lookup = { glGetUniformLocation(handle, name_string.c_str()), active_it->type };
+        }
+    }
+
+    if (lookup.location == -1){
+        inactive_uniform_names.push_back(name_string);
     }
-    return it->second;
+    return uniform_locations.emplace_back(std::move(name_string), lookup).second;
+}
+
+bool OpenGL::Program::isAssignable(GLenum uniform_type, GLenum value_type) noexcept {
+    if (uniform_type == value_type){
+        return true;
+    }
+
+    switch (uniform_type){
+        // Booleans can be set by any scalar type of the same component count.
+        case GL_BOOL: return value_type == GL_INT || value_type == GL_UNSIGNED_INT || value_type == GL_FLOAT;
+        case GL_BOOL_VEC2: return value_type == GL_INT_VEC2 || value_type == GL_UNSIGNED_INT_VEC2 || value_type == GL_FLOAT_VEC2;
+        case GL_BOOL_VEC3: return value_type == GL_INT_VEC3 || value_type == GL_UNSIGNED_INT_VEC3 || value_type == GL_FLOAT_VEC3;
+        case GL_BOOL_VEC4: return value_type == GL_INT_VEC4 || value_type == GL_UNSIGNED_INT_VEC4 || value_type == GL_FLOAT_VEC4;
+
+        // Samplers are set by their texture unit.
+        case GL_SAMPLER_1D: case GL_SAMPLER_2D: case GL_SAMPLER_3D: case GL_SAMPLER_CUBE:
+        case GL_SAMPLER_1D_SHADOW: case GL_SAMPLER_2D_SHADOW: case GL_SAMPLER_CUBE_SHADOW:
+        case GL_SAMPLER_1D_ARRAY: case GL_SAMPLER_2D_ARRAY: case GL_SAMPLER_1D_ARRAY_SHADOW: case GL_SAMPLER_2D_ARRAY_SHADOW:
+        case GL_SAMPLER_2D_MULTISAMPLE: case GL_SAMPLER_2D_MULTISAMPLE_ARRAY: case GL_SAMPLER_BUFFER: case GL_SAMPLER_2D_RECT: case GL_SAMPLER_2D_RECT_SHADOW:
+        case GL_INT_SAMPLER_1D: case GL_INT_SAMPLER_2D: case GL_INT_SAMPLER_3D: case GL_INT_SAMPLER_CUBE:
+        case GL_INT_SAMPLER_1D_ARRAY: case GL_INT_SAMPLER_2D_ARRAY: case GL_INT_SAMPLER_2D_MULTISAMPLE: case GL_INT_SAMPLER_2D_MULTISAMPLE_ARRAY:
+        case GL_INT_SAMPLER_BUFFER: case GL_INT_SAMPLER_2D_RECT:
+        case GL_UNSIGNED_INT_SAMPLER_1D: case GL_UNSIGNED_INT_SAMPLER_2D: case GL_UNSIGNED_INT_SAMPLER_3D: case GL_UNSIGNED_INT_SAMPLER_CUBE:
+        case GL_UNSIGNED_INT_SAMPLER_1D_ARRAY: case GL_UNSIGNED_INT_SAMPLER_2D_ARRAY: case GL_UNSIGNED_INT_SAMPLER_2D_MULTISAMPLE:
+        case GL_UNSIGNED_INT_SAMPLER_2D_MULTISAMPLE_ARRAY: case GL_UNSIGNED_INT_SAMPLER_BUFFER: case GL_UNSIGNED_INT_SAMPLER_2D_RECT:
+            return value_type == GL_INT;
+
+        default:
+            return false;
+    }
+}
+
+GLint OpenGL::Program::getUniformLocation(std::string_view name) const {
+    return findUniform(name).location;
+}
+
+std::span<const OpenGL::Program::ActiveVariable> OpenGL::Program::getActiveUniforms() const noexcept {
+    return active_uniforms;
+}
+
+std::span<const OpenGL::Program::ActiveVariable> OpenGL::Program::getActiveAttributes() const noexcept {
+    return active_attributes;
+}
+
+std::span<const std::string> OpenGL::Program::getInactiveUniformNames() const noexcept {
+    return inactive_uniform_names;
 }
 
 void OpenGL::Program::setUniformBlockBinding(const char *name, GLuint binding_point) const {
@@ -64,4 +357,8 @@ void OpenGL::Program::setUniformBlockBinding(const char *name, GLuint binding_po
 
 void OpenGL::Program::use() const {
     State::setProgram(handle);
+}
+
+const OpenGL::Program::Statistics &OpenGL::Program::getStatistics() noexcept {
+    return statistics;
 }
\ No newline at end of file
@@ -0,0 +1,62 @@
+//
+// Created by gomkyung2 on 2026/10/19.
+//
+
+#include "OpenGLApp/ProgramPipeline.hpp"
+
+#include <cassert>
+#include <stdexcept>
+
+#include "OpenGLApp/Capabilities.hpp"
+#include "OpenGLApp/State.hpp"
+
+namespace{
+    std::size_t pipeline_count = 0;
+
+    GLuint createPipeline() {
+        const OpenGL::Capabilities &capabilities = OpenGL::Capabilities::get();
+        if (!capabilities.separate_shader_objects){
+            throw std::runtime_error { "Program pipelines require GL 4.1 or ARB_separate_shader_objects." };
+        }
+
+        GLuint handle;
+        if (capabilities.direct_state_access){
+            glCreateProgramPipelines(1, &handle);
+        }
+        else{
+            glGenProgramPipelines(1, &handle);
+        }
+        return handle;
+    }
+}
+
+OpenGL::ProgramPipeline::ProgramPipeline() : handle { createPipeline() } {
+    ++pipeline_count;
+}
+
+OpenGL::ProgramPipeline::ProgramPipeline(const Program &vertex_program, const Program &fragment_program) : ProgramPipeline { } {
+    setStages(vertex_program);
+    setStages(fragment_program);
+}
+
+OpenGL::ProgramPipeline::~ProgramPipeline() noexcept {
+    State::deletePipeline(handle);
+    --pipeline_count;
+}
+
+void OpenGL::ProgramPipeline::setStages(const Program &program) {
+    assert(program.isSeparable() && "Only separable programs can be used in a pipeline.");
+    glUseProgramStages(handle, program.getStages(), program.getHandle());
+}
+
+void OpenGL::ProgramPipeline::use() const {
+    State::setPipeline(handle);
+}
+
+GLuint OpenGL::ProgramPipeline::getHandle() const noexcept {
+    return handle;
+}
+
+std::size_t OpenGL::ProgramPipeline::getCount() noexcept {
+    return pipeline_count;
+}
@@ -0,0 +1,102 @@
+//
+// Created by gomkyung2 on 2026/10/19.
+//
+
+#include "OpenGLApp/ProgramVariants.hpp"
+
+#include <algorithm>
+
+namespace{
+    OpenGL::ShaderDefines sortDefines(OpenGL::ShaderDefines defines){
+        std::ranges::sort(defines);
+        return defines;
+    }
+
+    std::string makeDefinesKey(const OpenGL::ShaderDefines &sorted_defines){
+        std::string key;
+        for (const auto &[name, value] : sorted_defines){
+            key.append(name).append("=").append(value).append(";");
+        }
+        return key;
+    }
+}
+
+OpenGL::ProgramVariants::ProgramVariants(ShaderPreprocessor preprocessor) : preprocessor { std::move(preprocessor) } {
+
+}
+
+const OpenGL::Shader &OpenGL::ProgramVariants::getShader(GLenum type, const std::filesystem::path &path, const ShaderDefines &sorted_defines) {
+    std::string key = std::to_string(type) + '|' + path.lexically_normal().string() + '|' + makeDefinesKey(sorted_defines);
+    auto it = shaders.find(key);
+    if (it == shaders.end()){
+        const std::string source = preprocessor.preprocess(path, sorted_defines);
+        it = shaders.emplace(std::move(key), std::unique_ptr<Shader> { new Shader(Shader::fromSource(type, source.c_str())) }).first;
+    }
+    return *it->second;
+}
+
+OpenGL::Program &OpenGL::ProgramVariants::get(const std::filesystem::path &vertex_shader_path, const std::filesystem::path &fragment_shader_path, const ShaderDefines &defines) {
+    const ShaderDefines sorted_defines = sortDefines(defines);
+    std::string key = vertex_shader_path.lexically_normal().string() + '|' + fragment_shader_path.lexically_normal().string() + '|' + makeDefinesKey(sorted_defines);
+
+    auto it = programs.find(key);
+    if (it == programs.end()){
+        const Shader &vertex_shader = getShader(GL_VERTEX_SHADER, vertex_shader_path, sorted_defines);
+        const Shader &fragment_shader = getShader(GL_FRAGMENT_SHADER, fragment_shader_path, sorted_defines);
+        it = programs.emplace(std::move(key), std::make_unique<Program>(vertex_shader, fragment_shader)).first;
+    }
+    return *it->second;
+}
+
+OpenGL::Program &OpenGL::ProgramVariants::get(const Variant &variant) {
+    return get(variant.vertex_shader_path, variant.fragment_shader_path, variant.defines);
+}
+
+void OpenGL::ProgramVariants::warmUp(std::span<const Variant> variants) {
+    for (const Variant &variant : variants){
+        get(variant);
+    }
+}
+
+OpenGL::Program &OpenGL::ProgramVariants::getStageProgram(GLenum type, const std::filesystem::path &path, const ShaderDefines &defines) {
+    const ShaderDefines sorted_defines = sortDefines(defines);
+    std::string key = std::to_string(type) + '|' + path.lexically_normal().string() + '|' + makeDefinesKey(sorted_defines);
+
+    auto it = stage_programs.find(key);
+    if (it == stage_programs.end()){
+        it = stage_programs.emplace(std::move(key), std::make_unique<Program>(getShader(type, path, sorted_defines))).first;
+    }
+    return *it->second;
+}
+
+OpenGL::ProgramPipeline &OpenGL::ProgramVariants::getPipeline(const std::filesystem::path &vertex_shader_path, const std::filesystem::path &fragment_shader_path, const ShaderDefines &defines) {
+    std::string key = vertex_shader_path.lexically_normal().string() + '|' + fragment_shader_path.lexically_normal().string() + '|' + makeDefinesKey(sortDefines(defines));
+
+    auto it = pipelines.find(key);
+    if (it == pipelines.end()){
+        const Program &vertex_program = getStageProgram(GL_VERTEX_SHADER, vertex_shader_path, defines);
+        const Program &fragment_program = getStageProgram(GL_FRAGMENT_SHADER, fragment_shader_path, defines);
+        it = pipelines.emplace(std::move(key), std::make_unique<ProgramPipeline>(vertex_program, fragment_program)).first;
+    }
+    return *it->second;
+}
+
+OpenGL::ProgramPipeline &OpenGL::ProgramVariants::getPipeline(const Variant &variant) {
+    return getPipeline(variant.vertex_shader_path, variant.fragment_shader_path, variant.defines);
+}
+
+std::size_t OpenGL::ProgramVariants::getProgramCount() const noexcept {
+    return programs.size();
+}
+
+std::size_t OpenGL::ProgramVariants::getShaderCount() const noexcept {
+    return shaders.size();
+}
+
+std::size_t OpenGL::ProgramVariants::getStageProgramCount() const noexcept {
+    return stage_programs.size();
+}
+
+std::size_t OpenGL::ProgramVariants::getPipelineCount() const noexcept {
+    return pipelines.size();
+}
@@ -0,0 +1,197 @@
+//
+// Created by gomkyung2 on 2026/10/19.
+//
+
+#include "OpenGLApp/RenderQueue.hpp"
+
+#include <algorithm>
+#include <cassert>
+#include <optional>
+#include <ranges>
+#include <stdexcept>
+#include <utility>
+
+#include "OpenGLApp/GLInterceptCore.hpp"
+#include "OpenGLApp/State.hpp"
+
+namespace{
+    std::uint64_t getDenseIndex(std::unordered_map<GLuint, std::uint64_t> &indices, GLuint handle, std::uint64_t mask){
+        const auto [it, inserted] = indices.try_emplace(handle, indices.size());
+        assert(it->second <= mask && "Too many distinct objects in a submit for their sort key field.");
+        return it->second;
+    }
+
+    template <typename Entry>
+    void radixSort(std::vector<Entry> &entries, std::vector<Entry> &scratch){
+        constexpr std::size_t byte_count = sizeof(Entry::key);
+
+        // Build the histograms of every byte in a single pass.
+        std::array<std::array<std::size_t, 256>, byte_count> histograms {};
+        for (const Entry &entry : entries){
+            for (std::size_t byte = 0; byte < byte_count; ++byte){
+                ++histograms[byte][(entry.key >> (8 * byte)) & 0xFF];
+            }
+        }
+
+        scratch.resize(entries.size());
+        for (std::size_t byte = 0; byte < byte_count; ++byte){
+            std::array<std::size_t, 256> &histogram = histograms[byte];
+            const std::size_t shift = 8 * byte;
+
+            // Every key has the same value in this byte, so the pass would not change the order.
+            if (entries.empty() || histogram[(entries.front().key >> shift) & 0xFF] == entries.size()){
+                continue;
+            }
+
+            std::size_t offset = 0;
+            for (std::size_t &count : histogram){
+                offset += std::exchange(count, offset);
+            }
+            for (const Entry &entry : entries){
+                scratch[histogram[(entry.key >> shift) & 0xFF]++] = entry;
+            }
+            entries.swap(scratch);
+        }
+    }
+}
+
+std::uint64_t OpenGL::RenderQueue::makeKey(const DrawItem &item) {
+    const std::uint64_t target = getDenseIndex(framebuffer_indices, item.framebuffer, 0xF);
+    const std::uint64_t pass = item.pass & 0xF;
+    const std::uint64_t program = getDenseIndex(program_indices, item.program, 0xFFF);
+    const std::uint64_t material = item.material;
+    const std::uint64_t vertex_array = getDenseIndex(vertex_array_indices, item.vertex_array, 0xFFF);
+
+    const float normalized_depth = std::clamp((item.depth - depth_near) / (depth_far - depth_near), 0.f, 1.f);
+    const auto depth = static_cast<std::uint64_t>(normalized_depth * 0xFFFF);
+
+    if (depth_orders[item.pass] == DepthOrder::BackToFront){
+        return target << 60 | pass << 56 | (0xFFFF - depth) << 40 | program << 28 | material << 12 | vertex_array;
+    }
+    return target << 60 | pass << 56 | program << 44 | material << 28 | vertex_array << 16 | depth;
+}
+
+void OpenGL::RenderQueue::bindMaterial(MaterialId material) const {
+    if (material == no_material){
+        return;
+    }
+
+    const std::vector<TextureBinding> &textures = materials[material];
+    for (std::size_t unit = 0; unit < textures.size(); ++unit){
+        glActiveTexture(GL_TEXTURE0 + static_cast<GLenum>(unit));
+        glBindTexture(textures[unit].target, textures[unit].texture);
+    }
+}
+
+template <typename Indices>
+OpenGL::RenderQueue::SwitchCounts OpenGL::RenderQueue::countSwitches(Indices &&indices) const {
+    SwitchCounts counts;
+    const DrawItem *previous = nullptr;
+    for (std::size_t index : indices){
+        const DrawItem &item = items[index];
+        counts.framebuffer += !previous || previous->framebuffer != item.framebuffer;
+        counts.program += !previous || previous->program != item.program;
+        counts.material += !previous || previous->material != item.material;
+        counts.vertex_array += !previous || previous->vertex_array != item.vertex_array;
+        previous = &item;
+    }
+    return counts;
+}
+
+OpenGL::RenderQueue::MaterialId OpenGL::RenderQueue::addMaterial(std::vector<TextureBinding> textures) {
+    assert(materials.size() < no_material && "Too many materials.");
+    materials.emplace_back(std::move(textures));
+    return static_cast<MaterialId>(materials.size() - 1);
+}
+
+void OpenGL::RenderQueue::setDepthRange(float near, float far) {
+    if (near == far){
+        throw std::runtime_error { "Depth range of the render queue must not be empty." };
+    }
+    depth_near = near;
+    depth_far = far;
+}
+
+void OpenGL::RenderQueue::setDepthOrder(std::uint8_t pass, DepthOrder order) noexcept {
+    assert(pass < max_pass_count);
+    depth_orders[pass] = order;
+}
+
+void OpenGL::RenderQueue::setPassCallback(std::uint8_t pass, std::function<void()> callback) {
+    assert(pass < max_pass_count);
+    pass_callbacks[pass] = std::move(callback);
+}
+
+void OpenGL::RenderQueue::setSorting(bool enabled) noexcept {
+    sorting = enabled;
+}
+
+void OpenGL::RenderQueue::push(const DrawItem &item) {
+    assert(item.pass < max_pass_count);
+    assert(item.material == no_material || item.material < materials.size());
+    items.push_back(item);
+}
+
+void OpenGL::RenderQueue::submit() {
+    // Dense indices are assigned per submit, so that the objects of the previous frames do not use up the key fields.
+    framebuffer_indices.clear();
+    program_indices.clear();
+    vertex_array_indices.clear();
+
+    sort_entries.clear();
+    for (std::size_t index = 0; index < items.size(); ++index){
+        sort_entries.emplace_back(sorting ? makeKey(items[index]) : 0, static_cast<std::uint32_t>(index));
+    }
+    if (sorting){
+        radixSort(sort_entries, sort_scratch);
+    }
+
+    statistics.draw_count = items.size();
+    statistics.unsorted = countSwitches(std::views::iota(std::size_t { 0 }, items.size()));
+    statistics.sorted = countSwitches(sort_entries | std::views::transform(&SortEntry::index));
+
+    std::optional<GLuint> framebuffer, vertex_array;
+    std::optional<std::uint8_t> pass;
+    std::optional<MaterialId> material;
+    for (const SortEntry &entry : sort_entries){
+        const DrawItem &item = items[entry.index];
+
+        if (framebuffer != item.framebuffer){
+            glBindFramebuffer(GL_FRAMEBUFFER, item.framebuffer);
+            framebuffer = item.framebuffer;
+            pass.reset(); // Pass begins again in the new render target.
+        }
+        if (pass != item.pass){
+            pass = item.pass;
+            if (pass_callbacks[item.pass]){
+                pass_callbacks[item.pass]();
+            }
+        }
+        State::setProgram(item.program);
+        if (material != item.material){
+            bindMaterial(item.material);
+            material = item.material;
+        }
+        if (vertex_array != item.vertex_array){
+            glBindVertexArray(item.vertex_array);
+            vertex_array = item.vertex_array;
+        }
+        if (item.set_uniforms){
+            item.set_uniforms(item.user_data);
+        }
+
+        const auto *indices = reinterpret_cast<const void*>(item.first);
+        if (item.index_type == GL_NONE){
+            glDrawArraysInstanced(item.mode, static_cast<GLint>(item.first), item.count, item.instance_count);
+        }
+        else{
+            glDrawElementsInstanced(item.mode, item.count, item.index_type, indices, item.instance_count);
+        }
+    }
+
+    items.clear();
+}
+
+const OpenGL::RenderQueue::Statistics &OpenGL::RenderQueue::getStatistics() const noexcept {
+    return statistics;
+}
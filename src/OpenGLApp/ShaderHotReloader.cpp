@@ -0,0 +1,344 @@
+//
+// Created by gomkyung2 on 2026/10/19.
+//
+
+#include "OpenGLApp/ShaderHotReloader.hpp"
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <iostream>
+#include <utility>
+
+#ifdef __linux__
+#include <poll.h>
+#include <sys/eventfd.h>
+#include <sys/inotify.h>
+#include <unistd.h>
+#endif
+
+namespace{
+    std::filesystem::path normalize(const std::filesystem::path &path){
+        return std::filesystem::absolute(path).lexically_normal();
+    }
+
+    std::string getShaderInfoLog(GLuint shader){
+        GLint length;
+        glGetShaderiv(shader, GL_INFO_LOG_LENGTH, &length);
+        std::string info_log(std::max(length, 1), '\0');
+        glGetShaderInfoLog(shader, length, nullptr, info_log.data());
+        return info_log;
+    }
+
+    std::string getProgramInfoLog(GLuint program){
+        GLint length;
+        glGetProgramiv(program, GL_INFO_LOG_LENGTH, &length);
+        std::string info_log(std::max(length, 1), '\0');
+        glGetProgramInfoLog(program, length, nullptr, info_log.data());
+        return info_log;
+    }
+}
+
+OpenGL::ShaderHotReloader::ShaderHotReloader(ShaderPreprocessor preprocessor, ErrorCallback error_callback)
+        : preprocessor { std::move(preprocessor) },
+          parallel_compile { GLEW_KHR_parallel_shader_compile || GLEW_ARB_parallel_shader_compile },
+          error_callback { std::move(error_callback) }
+{
+    if (!this->error_callback){
+        this->error_callback = [](const auto &vertex_shader_path, const auto &fragment_shader_path, std::string_view info_log){
+            std::cerr << "Failed to reload shader (" << vertex_shader_path << ", " << fragment_shader_path << "):\n" << info_log << '\n';
+        };
+    }
+
+    // Let the driver use as many threads as it wants.
+    if (GLEW_KHR_parallel_shader_compile){
+        glMaxShaderCompilerThreadsKHR(0xFFFFFFFF);
+    }
+    else if (GLEW_ARB_parallel_shader_compile){
+        glMaxShaderCompilerThreadsARB(0xFFFFFFFF);
+    }
+
+#ifdef __linux__
+    inotify_fd = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+    wakeup_fd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+    if (inotify_fd == -1 || wakeup_fd == -1){
+        throw std::runtime_error { "Failed to initialize inotify" };
+    }
+#endif
+
+    watcher_thread = std::jthread { [this](std::stop_token stop_token) { watcherMain(std::move(stop_token)); } };
+}
+
+OpenGL::ShaderHotReloader::~ShaderHotReloader() noexcept {
+    watcher_thread.request_stop();
+#ifdef __linux__
+    const std::uint64_t value = 1;
+    [[maybe_unused]] const auto result = write(wakeup_fd, &value, sizeof(value));
+#endif
+    watcher_thread.join();
+
+#ifdef __linux__
+    close(inotify_fd);
+    close(wakeup_fd);
+#endif
+
+    for (const Build &build : builds){
+        discardBuild(build);
+    }
+}
+
+void OpenGL::ShaderHotReloader::watch(Program &program, const std::filesystem::path &vertex_shader_path, const std::filesystem::path &fragment_shader_path, const ShaderDefines &defines) {
+    WatchedProgram watched { &program, normalize(vertex_shader_path), normalize(fragment_shader_path), defines, {}, {} };
+
+    // Preprocess once to know which files are included.
+    std::vector<std::filesystem::path> source_files, fragment_source_files;
+    [[maybe_unused]] const auto vertex_shader_source = preprocessor.preprocess(watched.vertex_shader_path, defines, &source_files);
+    [[maybe_unused]] const auto fragment_shader_source = preprocessor.preprocess(watched.fragment_shader_path, defines, &fragment_source_files);
+    source_files.insert(source_files.end(), fragment_source_files.begin(), fragment_source_files.end());
+
+    std::lock_guard lock { mutex };
+    watchSourceFiles(watched, std::move(source_files));
+    watched_programs.emplace_back(std::move(watched));
+}
+
+void OpenGL::ShaderHotReloader::watchSourceFiles(WatchedProgram &watched, std::vector<std::filesystem::path> source_files) {
+    // Called with the mutex locked.
+    for (std::filesystem::path &path : source_files){
+        path = normalize(path);
+    }
+    std::ranges::sort(source_files);
+    const auto [first, last] = std::ranges::unique(source_files);
+    source_files.erase(first, last);
+
+#ifdef __linux__
+    // Watch the directories rather than the files, since many editors save the file by replacing it.
+    for (const auto &path : source_files){
+        const auto directory = path.parent_path();
+        if (std::ranges::find(watch_descriptors, directory, [](const auto &pair) { return pair.second; }) == watch_descriptors.end()){
+            const int wd = inotify_add_watch(inotify_fd, directory.c_str(), IN_CLOSE_WRITE | IN_MOVED_TO | IN_CREATE);
+            if (wd == -1){
+                throw std::runtime_error { "Failed to watch directory " + directory.string() };
+            }
+            watch_descriptors.emplace_back(wd, directory);
+        }
+    }
+#else
+    watched.last_write_time = {};
+    for (const auto &path : source_files){
+        std::error_code error_code;
+        watched.last_write_time = std::max(watched.last_write_time, std::filesystem::last_write_time(path, error_code));
+    }
+#endif
+    watched.source_files = std::move(source_files);
+}
+
+void OpenGL::ShaderHotReloader::unwatch(const Program &program) {
+    {
+        std::lock_guard lock { mutex };
+        std::erase_if(watched_programs, [&](const WatchedProgram &watched) { return watched.program == &program; });
+        std::erase_if(changed_sources, [&](const ChangedSources &sources) { return sources.program == &program; });
+    }
+
+    std::erase_if(builds, [&](const Build &build) {
+        if (build.program == &program){
+            discardBuild(build);
+            return true;
+        }
+        return false;
+    });
+}
+
+void OpenGL::ShaderHotReloader::onFileChanged(const std::filesystem::path &path) {
+    // Preprocess the sources outside the GL thread. Called in the watcher thread with the mutex locked.
+    for (WatchedProgram &watched : watched_programs){
+        if (std::ranges::find(watched.source_files, path) == watched.source_files.end()){
+            continue;
+        }
+
+        std::string vertex_shader_source, fragment_shader_source;
+        try{
+            std::vector<std::filesystem::path> source_files, fragment_source_files;
+            vertex_shader_source = preprocessor.preprocess(watched.vertex_shader_path, watched.defines, &source_files);
+            fragment_shader_source = preprocessor.preprocess(watched.fragment_shader_path, watched.defines, &fragment_source_files);
+
+            // Includes may have been added or removed by the change.
+            source_files.insert(source_files.end(), fragment_source_files.begin(), fragment_source_files.end());
+            watchSourceFiles(watched, std::move(source_files));
+        }
+        catch (const std::runtime_error &e){
+            // Keep the old program, and report the error in the GL thread like the compile errors.
+            preprocess_errors.emplace_back(watched.vertex_shader_path, watched.fragment_shader_path, e.what());
+            continue;
+        }
+
+        // If the program is already changed but not built yet, only the latest sources are needed.
+        std::erase_if(changed_sources, [&](const ChangedSources &sources) { return sources.program == watched.program; });
+        changed_sources.emplace_back(watched.program,
+                                     watched.vertex_shader_path,
+                                     watched.fragment_shader_path,
+                                     std::move(vertex_shader_source),
+                                     std::move(fragment_shader_source));
+    }
+}
+
+void OpenGL::ShaderHotReloader::watcherMain(std::stop_token stop_token) {
+#ifdef __linux__
+    alignas(inotify_event) std::array<char, 4096> buffer;
+    std::array<pollfd, 2> poll_fds {
+        pollfd { inotify_fd, POLLIN, 0 },
+        pollfd { wakeup_fd, POLLIN, 0 },
+    };
+
+    while (!stop_token.stop_requested()){
+        if (::poll(poll_fds.data(), poll_fds.size(), -1) <= 0 || !(poll_fds[0].revents & POLLIN)){
+            continue;
+        }
+
+        ssize_t length;
+        while ((length = read(inotify_fd, buffer.data(), buffer.size())) > 0){
+            std::lock_guard lock { mutex };
+            for (const char *ptr = buffer.data(); ptr < buffer.data() + length; ){
+                const auto *event = reinterpret_cast<const inotify_event*>(ptr);
+                ptr += sizeof(inotify_event) + event->len;
+                if (event->len == 0){
+                    continue;
+                }
+
+                auto it = std::ranges::find(watch_descriptors, event->wd, [](const auto &pair) { return pair.first; });
+                if (it != watch_descriptors.end()){
+                    onFileChanged(it->second / event->name);
+                }
+            }
+        }
+    }
+#else
+    // No portable file change notification: check the modification times periodically.
+    using namespace std::chrono_literals;
+    while (!stop_token.stop_requested()){
+        std::this_thread::sleep_for(250ms);
+
+        std::lock_guard lock { mutex };
+        for (WatchedProgram &watched : watched_programs){
+            for (const auto &path : watched.source_files){
+                std::error_code error_code;
+                const auto last_write_time = std::filesystem::last_write_time(path, error_code);
+                if (!error_code && last_write_time > watched.last_write_time){
+                    // May update source_files, so stop iterating them.
+                    watched.last_write_time = last_write_time;
+                    onFileChanged(std::filesystem::path { path });
+                    break;
+                }
+            }
+        }
+    }
+#endif
+}
+
+void OpenGL::ShaderHotReloader::startBuild(ChangedSources &&sources) {
+    // Newer sources supersede the build in progress.
+    std::erase_if(builds, [&](const Build &build) {
+        if (build.program == sources.program){
+            discardBuild(build);
+            return true;
+        }
+        return false;
+    });
+
+    const auto create_shader = [](GLenum type, const std::string &source){
+        const GLuint handle = glCreateShader(type);
+        const char *source_ptr = source.c_str();
+        glShaderSource(handle, 1, &source_ptr, nullptr);
+        glCompileShader(handle); // Returns immediately if parallel shader compile is enabled.
+        return handle;
+    };
+
+    builds.emplace_back(sources.program,
+                        std::move(sources.vertex_shader_path),
+                        std::move(sources.fragment_shader_path),
+                        create_shader(GL_VERTEX_SHADER, sources.vertex_shader_source),
+                        create_shader(GL_FRAGMENT_SHADER, sources.fragment_shader_source),
+                        0,
+                        Build::Stage::Compiling);
+}
+
+bool OpenGL::ShaderHotReloader::isCompleted(GLuint handle, bool is_program) const {
+    if (!parallel_compile){
+        return true; // Status query will block until completed.
+    }
+
+    GLint completed;
+    if (is_program){
+        glGetProgramiv(handle, GL_COMPLETION_STATUS_KHR, &completed);
+    }
+    else{
+        glGetShaderiv(handle, GL_COMPLETION_STATUS_KHR, &completed);
+    }
+    return completed == GL_TRUE;
+}
+
+void OpenGL::ShaderHotReloader::discardBuild(const Build &build) const {
+    glDeleteShader(build.vertex_shader);
+    glDeleteShader(build.fragment_shader);
+    if (build.program_handle != 0){
+        glDeleteProgram(build.program_handle);
+    }
+}
+
+void OpenGL::ShaderHotReloader::poll() {
+    std::vector<PreprocessError> errors;
+    {
+        std::lock_guard lock { mutex };
+        for (ChangedSources &sources : changed_sources){
+            startBuild(std::move(sources));
+        }
+        changed_sources.clear();
+        errors = std::exchange(preprocess_errors, {});
+    }
+
+    for (const PreprocessError &error : errors){
+        error_callback(error.vertex_shader_path, error.fragment_shader_path, error.message);
+    }
+
+    std::erase_if(builds, [this](Build &build) {
+        if (build.stage == Build::Stage::Compiling){
+            if (!isCompleted(build.vertex_shader, false) || !isCompleted(build.fragment_shader, false)){
+                return false;
+            }
+
+            for (GLuint shader : { build.vertex_shader, build.fragment_shader }){
+                GLint success;
+                glGetShaderiv(shader, GL_COMPILE_STATUS, &success);
+                if (!success){
+                    error_callback(build.vertex_shader_path, build.fragment_shader_path, getShaderInfoLog(shader));
+                    discardBuild(build);
+                    return true;
+                }
+            }
+
+            build.program_handle = glCreateProgram();
+            glAttachShader(build.program_handle, build.vertex_shader);
+            glAttachShader(build.program_handle, build.fragment_shader);
+            glLinkProgram(build.program_handle); // Returns immediately if parallel shader compile is enabled.
+            build.stage = Build::Stage::Linking;
+        }
+
+        if (!isCompleted(build.program_handle, true)){
+            return false;
+        }
+
+        GLint success;
+        glGetProgramiv(build.program_handle, GL_LINK_STATUS, &success);
+        if (!success){
+            error_callback(build.vertex_shader_path, build.fragment_shader_path, getProgramInfoLog(build.program_handle));
+            discardBuild(build);
+            return true;
+        }
+
+        // Shaders are no longer needed after linking. Program ownership is transferred.
+        glDeleteShader(build.vertex_shader);
+        glDeleteShader(build.fragment_shader);
+        build.program->replace(build.program_handle);
+        return true;
+    });
+}
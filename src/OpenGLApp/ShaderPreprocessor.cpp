@@ -0,0 +1,132 @@
+//
+// Created by gomkyung2 on 2026/10/19.
+//
+
+#include "OpenGLApp/ShaderPreprocessor.hpp"
+
+#include <algorithm>
+#include <fstream>
+#include <optional>
+#include <sstream>
+#include <stdexcept>
+#include <string_view>
+
+namespace{
+    std::string_view trimLeft(std::string_view str){
+        const auto first = str.find_first_not_of(" \t");
+        return first == std::string_view::npos ? std::string_view { } : str.substr(first);
+    }
+
+    /**
+     * @brief If \p line is a preprocessor directive of \p name , return the rest of the line.
+     * @param line Line to be checked.
+     * @param name Directive name without '#', e.g. "include".
+     * @return Argument of the directive, or \p std::nullopt if the line is not the directive.
+     */
+    std::optional<std::string_view> matchDirective(std::string_view line, std::string_view name){
+        line = trimLeft(line);
+        if (!line.starts_with('#')){
+            return std::nullopt;
+        }
+        line = trimLeft(line.substr(1));
+        if (!line.starts_with(name)){
+            return std::nullopt;
+        }
+        line.remove_prefix(name.size());
+        if (!line.empty() && line.front() != ' ' && line.front() != '\t' && line.front() != '"' && line.front() != '<'){
+            return std::nullopt; // e.g. "#includes".
+        }
+        return trimLeft(line);
+    }
+
+    struct Context{
+        const std::vector<std::filesystem::path> &include_directories;
+        std::vector<std::filesystem::path> included_files; // Index is the source string number.
+        std::vector<std::filesystem::path> include_stack;
+        std::ostringstream output;
+        bool defines_injected = false;
+    };
+
+    void processFile(Context &context, const std::filesystem::path &filename, const OpenGL::ShaderDefines *defines){
+        std::ifstream file { filename };
+        if (!file.is_open()){
+            throw std::runtime_error { "Failed to open shader source " + filename.string() };
+        }
+
+        const auto source_number = context.included_files.size();
+        context.included_files.push_back(filename);
+        context.include_stack.push_back(filename);
+
+        std::string line;
+        for (std::size_t line_number = 1; std::getline(file, line); ++line_number){
+            if (defines && matchDirective(line, "version")){
+                // Defines must be placed after #version, which must be the first directive of the main file.
+                context.output << line << '\n';
+                for (const auto &[name, value] : *defines){
+                    context.output << "#define " << name << ' ' << value << '\n';
+                }
+                context.output << "#line " << line_number + 1 << ' ' << source_number << '\n';
+                context.defines_injected = true;
+                defines = nullptr;
+                continue;
+            }
+
+            const auto include_argument = matchDirective(line, "include");
+            if (!include_argument){
+                context.output << line << '\n';
+                continue;
+            }
+
+            const std::string_view argument = include_argument.value();
+            const char closing = argument.starts_with('<') ? '>' : '"';
+            const auto closing_pos = argument.find(closing, 1);
+            if (argument.empty() || (argument.front() != '"' && argument.front() != '<') || closing_pos == std::string_view::npos){
+                throw std::runtime_error { "Invalid #include directive in " + filename.string() + ":" + std::to_string(line_number) };
+            }
+            const std::filesystem::path include_path { argument.substr(1, closing_pos - 1) };
+
+            // Search in the directory of the including file first, then include directories.
+            std::optional<std::filesystem::path> resolved_path;
+            if (std::filesystem::exists(filename.parent_path() / include_path)){
+                resolved_path = (filename.parent_path() / include_path).lexically_normal();
+            }
+            for (auto it = context.include_directories.begin(); !resolved_path && it != context.include_directories.end(); ++it){
+                if (std::filesystem::exists(*it / include_path)){
+                    resolved_path = (*it / include_path).lexically_normal();
+                }
+            }
+            if (!resolved_path){
+                throw std::runtime_error { "Cannot find included file " + include_path.string() + " from " + filename.string() };
+            }
+
+            if (std::ranges::find(context.include_stack, resolved_path.value()) != context.include_stack.end()){
+                throw std::runtime_error { "Cyclic include of " + resolved_path->string() + " from " + filename.string() };
+            }
+            if (std::ranges::find(context.included_files, resolved_path.value()) == context.included_files.end()){
+                context.output << "#line 1 " << context.included_files.size() << '\n';
+                processFile(context, resolved_path.value(), nullptr);
+            }
+            context.output << "#line " << line_number + 1 << ' ' << source_number << '\n';
+        }
+
+        context.include_stack.pop_back();
+    }
+}
+
+OpenGL::ShaderPreprocessor::ShaderPreprocessor(std::vector<std::filesystem::path> include_directories)
+        : include_directories { std::move(include_directories) }
+{
+
+}
+
+std::string OpenGL::ShaderPreprocessor::preprocess(const std::filesystem::path &filename, const ShaderDefines &defines, std::vector<std::filesystem::path> *included_files) const {
+    Context context { include_directories };
+    processFile(context, filename.lexically_normal(), &defines);
+    if (!defines.empty() && !context.defines_injected){
+        throw std::runtime_error { "Cannot inject defines into " + filename.string() + ", which has no #version directive" };
+    }
+    if (included_files){
+        *included_files = std::move(context.included_files);
+    }
+    return std::move(context.output).str();
+}
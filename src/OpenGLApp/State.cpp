@@ -7,19 +7,31 @@
 #include <map>
 #include <queue>
 #include <functional>
+#include <utility>
 
 #include <glm/gtc/type_ptr.hpp>
 
+#include "OpenGLApp/Capabilities.hpp"
+
 namespace{
     std::optional<GLuint> current_program = std::nullopt;
+    std::optional<GLuint> current_pipeline = std::nullopt;
     std::map<GLuint, std::queue<std::function<void()>>> pending_uniforms;
 
-    void setUniform(GLuint program, std::function<void()> &&set_function){
-        if (current_program.has_value() && program == current_program.value()){
+    /**
+     * @brief Set a uniform of \p program by \p program_set_function (glProgramUniform*) if it is supported. Otherwise,
+     * by \p set_function (glUniform*) immediately if \p program is in use, or after it is used.
+     */
+    template <typename ProgramSetFunction, typename SetFunction>
+    void setUniform(GLuint program, ProgramSetFunction &&program_set_function, SetFunction &&set_function){
+        if (OpenGL::Capabilities::get().separate_shader_objects){
+            program_set_function();
+        }
+        else if (current_program.has_value() && program == current_program.value()){
             set_function();
         }
         else{
-            pending_uniforms[program].emplace(std::move(set_function));
+            pending_uniforms[program].emplace(std::forward<SetFunction>(set_function));
         }
     }
 
@@ -55,58 +67,129 @@ bool OpenGL::State::setProgram(GLuint program) {
     return false;
 }
 
+void OpenGL::State::flushPendingUniforms(GLuint program) {
+    auto it = pending_uniforms.find(program);
+    if (it == pending_uniforms.end() || it->second.empty()){
+        return;
+    }
+
+    const auto previous_program = current_program;
+    setProgram(program);
+    if (previous_program.has_value()){
+        setProgram(previous_program.value());
+    }
+}
+
+void OpenGL::State::replaceProgram(GLuint old_program, GLuint new_program) {
+    pending_uniforms.erase(old_program);
+    if (current_program.has_value() && current_program.value() == old_program){
+        current_program = std::nullopt;
+        setProgram(new_program);
+    }
+}
+
+std::optional<GLuint> OpenGL::State::getPipeline(){
+    return current_pipeline;
+}
+
+bool OpenGL::State::setPipeline(GLuint pipeline) {
+    setProgram(0);
+    if (!current_pipeline.has_value() || current_pipeline.value() != pipeline){
+        current_pipeline = pipeline;
+        glBindProgramPipeline(pipeline);
+        return true;
+    }
+    return false;
+}
+
+void OpenGL::State::deletePipeline(GLuint pipeline) {
+    glDeleteProgramPipelines(1, &pipeline);
+    if (current_pipeline.has_value() && current_pipeline.value() == pipeline){
+        // Deleting the bound pipeline reverts the binding to zero.
+        current_pipeline = 0;
+    }
+}
+
 void OpenGL::State::setUniform(GLuint program, GLint uniform_location, int value){
-    ::setUniform(program, [=]() { glUniform1i(uniform_location, value); });
+    ::setUniform(program,
+                 [&]() { glProgramUniform1i(program, uniform_location, value); },
+                 [=]() { glUniform1i(uniform_location, value); });
 }
 
 void OpenGL::State::setUniform(GLuint program, GLint uniform_location, unsigned int value){
-    ::setUniform(program, [=]() { glUniform1ui(uniform_location, value); });
+    ::setUniform(program,
+                 [&]() { glProgramUniform1ui(program, uniform_location, value); },
+                 [=]() { glUniform1ui(uniform_location, value); });
 }
 
 void OpenGL::State::setUniform(GLuint program, GLint uniform_location, float value){
-    ::setUniform(program, [=]() { glUniform1f(uniform_location, value); });
+    ::setUniform(program,
+                 [&]() { glProgramUniform1f(program, uniform_location, value); },
+                 [=]() { glUniform1f(uniform_location, value); });
 }
 
 void OpenGL::State::setUniform(GLuint program, GLint uniform_location, glm::ivec2 &&value){
-    ::setUniform(program, [=]() { glUniform2iv(uniform_location, 1, glm::value_ptr(value)); });
+    ::setUniform(program,
+                 [&]() { glProgramUniform2iv(program, uniform_location, 1, glm::value_ptr(value)); },
+                 [=]() { glUniform2iv(uniform_location, 1, glm::value_ptr(value)); });
 }
 
 void OpenGL::State::setUniform(GLuint program, GLint uniform_location, glm::uvec2 &&value){
-    ::setUniform(program, [=]() { glUniform2uiv(uniform_location, 1, glm::value_ptr(value)); });
+    ::setUniform(program,
+                 [&]() { glProgramUniform2uiv(program, uniform_location, 1, glm::value_ptr(value)); },
+                 [=]() { glUniform2uiv(uniform_location, 1, glm::value_ptr(value)); });
 }
 
 void OpenGL::State::setUniform(GLuint program, GLint uniform_location, glm::vec2 &&value){
-    ::setUniform(program, [=]() { glUniform2fv(uniform_location, 1, glm::value_ptr(value)); });
+    ::setUniform(program,
+                 [&]() { glProgramUniform2fv(program, uniform_location, 1, glm::value_ptr(value)); },
+                 [=]() { glUniform2fv(uniform_location, 1, glm::value_ptr(value)); });
 }
 
 void OpenGL::State::setUniform(GLuint program, GLint uniform_location, glm::ivec3 &&value){
-    ::setUniform(program, [=]() { glUniform3iv(uniform_location, 1, glm::value_ptr(value)); });
+    ::setUniform(program,
+                 [&]() { glProgramUniform3iv(program, uniform_location, 1, glm::value_ptr(value)); },
+                 [=]() { glUniform3iv(uniform_location, 1, glm::value_ptr(value)); });
 }
 
 void OpenGL::State::setUniform(GLuint program, GLint uniform_location, glm::uvec3 &&value){
-    ::setUniform(program, [=]() { glUniform3uiv(uniform_location, 1, glm::value_ptr(value)); });
+    ::setUniform(program,
+                 [&]() { glProgramUniform3uiv(program, uniform_location, 1, glm::value_ptr(value)); },
+                 [=]() { glUniform3uiv(uniform_location, 1, glm::value_ptr(value)); });
 }
 
 void OpenGL::State::setUniform(GLuint program, GLint uniform_location, glm::vec3 &&value){
-    ::setUniform(program, [=]() { glUniform3fv(uniform_location, 1, glm::value_ptr(value)); });
+    ::setUniform(program,
+                 [&]() { glProgramUniform3fv(program, uniform_location, 1, glm::value_ptr(value)); },
+                 [=]() { glUniform3fv(uniform_location, 1, glm::value_ptr(value)); });
 }
 
 void OpenGL::State::setUniform(GLuint program, GLint uniform_location, glm::ivec4 &&value){
-    ::setUniform(program, [=]() { glUniform4iv(uniform_location, 1, glm::value_ptr(value)); });
+    ::setUniform(program,
+                 [&]() { glProgramUniform4iv(program, uniform_location, 1, glm::value_ptr(value)); },
+                 [=]() { glUniform4iv(uniform_location, 1, glm::value_ptr(value)); });
 }
 
 void OpenGL::State::setUniform(GLuint program, GLint uniform_location, glm::uvec4 &&value){
-    ::setUniform(program, [=]() { glUniform4uiv(uniform_location, 1, glm::value_ptr(value)); });
+    ::setUniform(program,
+                 [&]() { glProgramUniform4uiv(program, uniform_location, 1, glm::value_ptr(value)); },
+                 [=]() { glUniform4uiv(uniform_location, 1, glm::value_ptr(value)); });
 }
 
 void OpenGL::State::setUniform(GLuint program, GLint uniform_location, glm::vec4 &&value){
-    ::setUniform(program, [=]() { glUniform4fv(uniform_location, 1, glm::value_ptr(value)); });
+    ::setUniform(program,
+                 [&]() { glProgramUniform4fv(program, uniform_location, 1, glm::value_ptr(value)); },
+                 [=]() { glUniform4fv(uniform_location, 1, glm::value_ptr(value)); });
 }
 
 void OpenGL::State::setUniform(GLuint program, GLint uniform_location, glm::mat3 &&value){
-    ::setUniform(program, [=]() { glUniformMatrix3fv(uniform_location, 1, GL_FALSE, glm::value_ptr(value)); });
+    ::setUniform(program,
+                 [&]() { glProgramUniformMatrix3fv(program, uniform_location, 1, GL_FALSE, glm::value_ptr(value)); },
+                 [=]() { glUniformMatrix3fv(uniform_location, 1, GL_FALSE, glm::value_ptr(value)); });
 }
 
 void OpenGL::State::setUniform(GLuint program, GLint uniform_location, glm::mat4 &&value){
-    ::setUniform(program, [=]() { glUniformMatrix4fv(uniform_location, 1, GL_FALSE, glm::value_ptr(value)); });
+    ::setUniform(program,
+                 [&]() { glProgramUniformMatrix4fv(program, uniform_location, 1, GL_FALSE, glm::value_ptr(value)); },
+                 [=]() { glUniformMatrix4fv(uniform_location, 1, GL_FALSE, glm::value_ptr(value)); });
 }
\ No newline at end of file
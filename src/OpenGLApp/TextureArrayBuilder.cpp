@@ -0,0 +1,115 @@
+//
+// Created by gomkyung2 on 2026/10/19.
+//
+
+#include "OpenGLApp/TextureArrayBuilder.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <cassert>
+#include <stdexcept>
+
+#include "OpenGLApp/BindlessTexture.hpp"
+#include "OpenGLApp/Capabilities.hpp"
+#include "OpenGLApp/GLInterceptCore.hpp"
+
+OpenGL::TextureArrayBuilder::~TextureArrayBuilder() noexcept {
+    for (GLuint64 handle : bindless_handles){
+        BindlessTexture::makeNonResident(handle);
+    }
+    glDeleteTextures(static_cast<GLsizei>(textures.size()), textures.data());
+}
+
+std::size_t OpenGL::TextureArrayBuilder::add(const Utils::Image &image) {
+    assert(textures.empty() && "Images must be added before build().");
+    if (image.getChannels() < 1 || image.getChannels() > 4){
+        throw std::runtime_error { "Unsupported image channel count." };
+    }
+
+    images.push_back(&image);
+    return images.size() - 1;
+}
+
+void OpenGL::TextureArrayBuilder::build() {
+    assert(textures.empty() && "Texture arrays are already built.");
+
+    std::vector<Group> groups;
+    for (std::size_t index = 0; index < images.size(); ++index){
+        const Utils::Image &image = *images[index];
+        const Utils::Image::GLFormat format = image.getGLFormat();
+        auto it = std::ranges::find_if(groups, [&](const Group &group){
+            return group.width == image.getWidth() && group.height == image.getHeight() && group.format.internal_format == format.internal_format
+                && group.format.format == format.format && group.format.type == format.type;
+        });
+        if (it == groups.end()){
+            it = groups.insert(groups.end(), Group { image.getWidth(), image.getHeight(), format, {} });
+        }
+        it->image_indices.push_back(index);
+    }
+
+    // Rows of 1 to 3 channel images are not 4-byte aligned in general.
+    GLint previous_unpack_alignment;
+    glGetIntegerv(GL_UNPACK_ALIGNMENT, &previous_unpack_alignment);
+    glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+
+    layers.resize(images.size());
+    textures.resize(groups.size());
+    const bool direct_state_access = Capabilities::get().direct_state_access;
+    if (direct_state_access){
+        glCreateTextures(GL_TEXTURE_2D_ARRAY, static_cast<GLsizei>(textures.size()), textures.data());
+    }
+    else{
+        glGenTextures(static_cast<GLsizei>(textures.size()), textures.data());
+    }
+    for (std::size_t group_index = 0; group_index < groups.size(); ++group_index){
+        const Group &group = groups[group_index];
+        const GLuint texture = textures[group_index];
+        const auto [internal_format, format, type] = group.format;
+        const auto layer_count = static_cast<GLsizei>(group.image_indices.size());
+
+        if (direct_state_access){
+            // Immutable storage needs the full mip chain up front.
+            const auto level_count = static_cast<GLsizei>(std::bit_width(static_cast<unsigned int>(std::max(group.width, group.height))));
+            glTextureStorage3D(texture, level_count, internal_format, group.width, group.height, layer_count);
+            for (std::size_t layer = 0; layer < group.image_indices.size(); ++layer){
+                const Utils::Image &image = *images[group.image_indices[layer]];
+                glTextureSubImage3D(texture, 0, 0, 0, static_cast<GLint>(layer), image.getWidth(), image.getHeight(), 1, format, type, image.getData());
+            }
+            glTextureParameteri(texture, GL_TEXTURE_MIN_FILTER, GL_LINEAR_MIPMAP_LINEAR);
+            glTextureParameteri(texture, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+            glGenerateTextureMipmap(texture);
+        }
+        else{
+            glBindTexture(GL_TEXTURE_2D_ARRAY, texture);
+            glTexImage3D(GL_TEXTURE_2D_ARRAY, 0, static_cast<GLint>(internal_format),
+                         group.width, group.height, layer_count, 0, format, type, nullptr);
+            for (std::size_t layer = 0; layer < group.image_indices.size(); ++layer){
+                const Utils::Image &image = *images[group.image_indices[layer]];
+                glTexSubImage3D(GL_TEXTURE_2D_ARRAY, 0, 0, 0, static_cast<GLint>(layer), image.getWidth(), image.getHeight(), 1, format, type, image.getData());
+            }
+            glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_MIN_FILTER, GL_LINEAR_MIPMAP_LINEAR);
+            glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+            glGenerateMipmap(GL_TEXTURE_2D_ARRAY);
+        }
+
+        const GLuint64 bindless_handle = BindlessTexture::makeResident(texture);
+        if (bindless_handle != 0){
+            bindless_handles.push_back(bindless_handle);
+        }
+
+        for (std::size_t layer = 0; layer < group.image_indices.size(); ++layer){
+            layers[group.image_indices[layer]] = { texture, static_cast<GLint>(layer), bindless_handle };
+        }
+    }
+
+    glPixelStorei(GL_UNPACK_ALIGNMENT, previous_unpack_alignment);
+    images.clear();
+}
+
+const OpenGL::TextureArrayBuilder::Layer &OpenGL::TextureArrayBuilder::getLayer(std::size_t image_index) const noexcept {
+    return layers[image_index];
+}
+
+std::span<const GLuint> OpenGL::TextureArrayBuilder::getTextures() const noexcept {
+    return textures;
+}
@@ -0,0 +1,103 @@
+//
+// Created by gomkyung2 on 2026/10/19.
+//
+
+#include "OpenGLApp/TextureAtlas.hpp"
+
+#include <algorithm>
+#include <cassert>
+#include <stdexcept>
+
+#include "OpenGLApp/BindlessTexture.hpp"
+#include "OpenGLApp/Capabilities.hpp"
+#include "OpenGLApp/GLInterceptCore.hpp"
+#include "OpenGLApp/MipChain.hpp"
+
+OpenGL::TextureAtlas::TextureAtlas(int width, int height, int padding)
+        : width { width }, height { height }, padding { padding }, packer { width, height },
+          pixels(static_cast<std::size_t>(width) * height * 4) {
+
+}
+
+OpenGL::TextureAtlas::~TextureAtlas() noexcept {
+    BindlessTexture::makeNonResident(bindless_handle);
+    glDeleteTextures(1, &handle);
+}
+
+std::optional<std::size_t> OpenGL::TextureAtlas::add(const Utils::Image &image) {
+    assert(handle == 0 && "Images must be added before build().");
+    if (image.getChannels() < 1 || image.getChannels() > 4){
+        throw std::runtime_error { "Unsupported image channel count." };
+    }
+
+    const std::optional<glm::ivec2> position = packer.pack(image.getWidth() + 2 * padding, image.getHeight() + 2 * padding);
+    if (!position){
+        return std::nullopt;
+    }
+
+    // Copy the image into the padded rectangle, clamping the source coordinates so that the padding repeats the edge.
+    const glm::ivec2 origin = *position + padding;
+    for (int y = -padding; y < image.getHeight() + padding; ++y){
+        const int source_y = std::clamp(y, 0, image.getHeight() - 1);
+        unsigned char *destination_row = pixels.data() + (static_cast<std::size_t>(origin.y + y) * width + origin.x - padding) * 4;
+        for (int x = -padding; x < image.getWidth() + padding; ++x){
+            const int source_x = std::clamp(x, 0, image.getWidth() - 1);
+            const unsigned char *source = image.getData() + (static_cast<std::size_t>(source_y) * image.getWidth() + source_x) * image.getChannels();
+            unsigned char *destination = destination_row + static_cast<std::size_t>(x + padding) * 4;
+            switch (image.getChannels()){
+                case 1: destination[0] = destination[1] = destination[2] = source[0]; destination[3] = 255; break;
+                case 2: destination[0] = destination[1] = destination[2] = source[0]; destination[3] = source[1]; break;
+                case 3: std::copy_n(source, 3, destination); destination[3] = 255; break;
+                default:
+                    if (image.getLayout() == Utils::Image::PixelLayout::Bgra){
+                        destination[0] = source[2]; destination[1] = source[1]; destination[2] = source[0]; destination[3] = source[3];
+                    }
+                    else{
+                        std::copy_n(source, 4, destination);
+                    }
+                    break;
+            }
+        }
+    }
+
+    const glm::vec2 atlas_size { width, height };
+    regions.emplace_back(glm::vec2 { origin } / atlas_size, glm::vec2 { image.getWidth(), image.getHeight() } / atlas_size);
+    return regions.size() - 1;
+}
+
+GLuint OpenGL::TextureAtlas::build() {
+    assert(handle == 0 && "Atlas is already built.");
+
+    // Mip levels are filtered in linear light, but stored as GL_RGBA8 so that sampling is the same as plain textures.
+    handle = MipChain { width, height, 4, pixels.data() }.createTexture(GL_RGBA8);
+    if (Capabilities::get().direct_state_access){
+        glTextureParameteri(handle, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+        glTextureParameteri(handle, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+    }
+    else{
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+    }
+
+    bindless_handle = BindlessTexture::makeResident(handle);
+
+    pixels.clear();
+    pixels.shrink_to_fit();
+    return handle;
+}
+
+const OpenGL::TextureAtlas::Region &OpenGL::TextureAtlas::getRegion(std::size_t index) const noexcept {
+    return regions[index];
+}
+
+GLuint OpenGL::TextureAtlas::getHandle() const noexcept {
+    return handle;
+}
+
+GLuint64 OpenGL::TextureAtlas::getBindlessHandle() const noexcept {
+    return bindless_handle;
+}
+
+float OpenGL::TextureAtlas::getOccupancy() const noexcept {
+    return packer.getOccupancy();
+}
@@ -0,0 +1,238 @@
+//
+// Created by gomkyung2 on 2026/10/19.
+//
+
+#include "OpenGLApp/TextureStreamer.hpp"
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <limits>
+
+#include <glm/geometric.hpp>
+
+#include "OpenGLApp/GLInterceptCore.hpp"
+
+namespace{
+    // Set GL_UNPACK_ALIGNMENT to 1 for the tightly packed levels in the scope.
+    class UnpackAlignmentScope{
+    private:
+        GLint previous;
+
+    public:
+        UnpackAlignmentScope() noexcept {
+            glGetIntegerv(GL_UNPACK_ALIGNMENT, &previous);
+            glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+        }
+
+        UnpackAlignmentScope(const UnpackAlignmentScope&) = delete;
+
+        ~UnpackAlignmentScope() noexcept {
+            glPixelStorei(GL_UNPACK_ALIGNMENT, previous);
+        }
+    };
+}
+
+std::size_t OpenGL::TextureStreamer::getLevelBytes(const Entry &entry, std::uint32_t level) noexcept {
+    const MipChain::Level &data = entry.mip_chain.getLevels()[level];
+
+    // Drivers store 3 channel textures with 4 bytes per texel.
+    const int channels = entry.mip_chain.getChannels();
+    return static_cast<std::size_t>(data.width) * data.height * (channels == 3 ? 4 : channels);
+}
+
+void OpenGL::TextureStreamer::uploadLevel(Entry &entry, std::uint32_t level) {
+    assert(level + 1 == entry.resident_level && "Levels must be uploaded from the coarsest.");
+
+    const MipChain::Level &data = entry.mip_chain.getLevels()[level];
+    glBindTexture(GL_TEXTURE_2D, entry.handle);
+    glTexImage2D(GL_TEXTURE_2D, static_cast<GLint>(level), static_cast<GLint>(entry.mip_chain.getInternalFormat()),
+                 data.width, data.height, 0, entry.mip_chain.getFormat(), GL_UNSIGNED_BYTE, data.pixels.data());
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_BASE_LEVEL, static_cast<GLint>(level));
+
+    entry.resident_level = level;
+    resident_bytes += getLevelBytes(entry, level);
+}
+
+void OpenGL::TextureStreamer::evictLevel(Entry &entry) {
+    assert(entry.resident_level < entry.floor_level && "The coarsest levels must not be evicted.");
+
+    const std::uint32_t level = entry.resident_level;
+    glBindTexture(GL_TEXTURE_2D, entry.handle);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_BASE_LEVEL, static_cast<GLint>(level + 1));
+    glTexImage2D(GL_TEXTURE_2D, static_cast<GLint>(level), static_cast<GLint>(entry.mip_chain.getInternalFormat()),
+                 0, 0, 0, entry.mip_chain.getFormat(), GL_UNSIGNED_BYTE, nullptr);
+
+    entry.resident_level = level + 1;
+    resident_bytes -= getLevelBytes(entry, level);
+    ++statistics.evicted_levels;
+}
+
+bool OpenGL::TextureStreamer::evictForRequest(std::size_t bytes, const Entry *requester) {
+    if (resident_bytes + bytes <= budget_bytes){
+        return true;
+    }
+
+    // Do not evict anything if the request cannot be satisfied anyway.
+    std::size_t evictable_bytes = 0;
+    for (const Entry &entry : entries){
+        if (&entry == requester){
+            continue;
+        }
+
+        const std::uint32_t keep_level = entry.last_request_frame == frame ? std::min(entry.requested_level, entry.floor_level) : entry.floor_level;
+        for (std::uint32_t level = entry.resident_level; level < keep_level; ++level){
+            evictable_bytes += getLevelBytes(entry, level);
+        }
+    }
+    if (resident_bytes + bytes > budget_bytes + evictable_bytes){
+        return false;
+    }
+
+    while (resident_bytes + bytes > budget_bytes){
+        // Textures not requested in this frame are evicted first, the least recently requested first. Then the levels
+        // finer than requested in this frame.
+        Entry *victim = nullptr;
+        std::pair<bool, std::uint64_t> victim_key { true, std::numeric_limits<std::uint64_t>::max() };
+        for (Entry &entry : entries){
+            if (&entry == requester || entry.resident_level >= entry.floor_level){
+                continue;
+            }
+
+            const bool requested_now = entry.last_request_frame == frame;
+            if (requested_now && entry.resident_level >= entry.requested_level){
+                continue;
+            }
+
+            if (const std::pair key { requested_now, entry.last_request_frame }; !victim || key < victim_key){
+                victim = &entry;
+                victim_key = key;
+            }
+        }
+
+        if (!victim){
+            return false;
+        }
+        evictLevel(*victim);
+    }
+    return true;
+}
+
+OpenGL::TextureStreamer::TextureStreamer(std::size_t budget_bytes, int initial_size, std::size_t upload_bytes_per_frame)
+        : budget_bytes { budget_bytes }, upload_bytes_per_frame { upload_bytes_per_frame }, initial_size { initial_size } {
+
+}
+
+OpenGL::TextureStreamer::~TextureStreamer() noexcept {
+    for (const Entry &entry : entries){
+        glDeleteTextures(1, &entry.handle);
+    }
+}
+
+std::size_t OpenGL::TextureStreamer::add(MipChain mip_chain) {
+    const auto level_count = static_cast<std::uint32_t>(mip_chain.getLevels().size());
+    Entry &entry = entries.emplace_back(std::move(mip_chain), 0, level_count, level_count - 1, level_count - 1, 0);
+
+    // Floor level is the finest level within the initial size.
+    const std::span levels = entry.mip_chain.getLevels();
+    while (entry.floor_level > 0 && std::max(levels[entry.floor_level - 1].width, levels[entry.floor_level - 1].height) <= initial_size){
+        --entry.floor_level;
+    }
+    entry.requested_level = entry.floor_level;
+
+    glGenTextures(1, &entry.handle);
+    glBindTexture(GL_TEXTURE_2D, entry.handle);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAX_LEVEL, static_cast<GLint>(level_count - 1));
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR_MIPMAP_LINEAR);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+
+    const UnpackAlignmentScope unpack_alignment_scope;
+    for (std::uint32_t level = level_count; level-- > entry.floor_level;){
+        uploadLevel(entry, level);
+    }
+
+    return entries.size() - 1;
+}
+
+GLuint OpenGL::TextureStreamer::getHandle(std::size_t texture) const noexcept {
+    return entries[texture].handle;
+}
+
+void OpenGL::TextureStreamer::request(std::size_t texture, float screen_size) noexcept {
+    Entry &entry = entries[texture];
+    const MipChain::Level &base = entry.mip_chain.getLevels().front();
+
+    // Level whose size is the closest to the screen size, not smaller than it.
+    const float level = std::floor(std::log2(static_cast<float>(std::max(base.width, base.height)) / screen_size));
+    const auto clamped_level = static_cast<std::uint32_t>(std::clamp(level, 0.f, static_cast<float>(entry.floor_level)));
+
+    entry.requested_level = entry.last_request_frame == frame ? std::min(entry.requested_level, clamped_level) : clamped_level;
+    entry.last_request_frame = frame;
+}
+
+void OpenGL::TextureStreamer::request(std::size_t texture, const PerspectiveCamera &camera, int framebuffer_height, const glm::vec3 &center, float radius) noexcept {
+    const float distance = glm::distance(camera.view.getPosition(), center);
+    if (distance <= radius){
+        request(texture, std::numeric_limits<float>::infinity());
+        return;
+    }
+
+    // Projected diameter of the bounding sphere in pixels.
+    request(texture, radius * static_cast<float>(framebuffer_height) / (distance * std::tan(camera.projection.fov / 2)));
+}
+
+void OpenGL::TextureStreamer::update() {
+    statistics.uploaded_levels = statistics.evicted_levels = statistics.starved_textures = 0;
+
+    // Budget may be lowered.
+    evictForRequest(0, nullptr);
+
+    std::vector<Entry*> requesters;
+    for (Entry &entry : entries){
+        if (entry.last_request_frame == frame && entry.requested_level < entry.resident_level){
+            requesters.push_back(&entry);
+        }
+    }
+    std::ranges::sort(requesters, std::ranges::greater{}, [](const Entry *entry){
+        return entry->resident_level - entry->requested_level;
+    });
+
+    // Upload a level per texture in each round, so that every texture gets closer to its request before any gets the
+    // finest level. At least one level is uploaded per frame even if it exceeds the upload limit.
+    const UnpackAlignmentScope unpack_alignment_scope;
+    std::size_t uploaded_bytes = 0;
+    for (bool progressed = true; progressed;){
+        progressed = false;
+        for (Entry *entry : requesters){
+            if (entry->resident_level <= entry->requested_level){
+                continue;
+            }
+
+            const std::uint32_t level = entry->resident_level - 1;
+            const std::size_t bytes = getLevelBytes(*entry, level);
+            if ((uploaded_bytes != 0 && uploaded_bytes + bytes > upload_bytes_per_frame) || !evictForRequest(bytes, entry)){
+                continue;
+            }
+
+            uploadLevel(*entry, level);
+            uploaded_bytes += bytes;
+            ++statistics.uploaded_levels;
+            progressed = true;
+        }
+    }
+
+    statistics.starved_textures = static_cast<std::size_t>(std::ranges::count_if(requesters, [](const Entry *entry){
+        return entry->resident_level > entry->requested_level;
+    }));
+    statistics.resident_bytes = resident_bytes;
+    statistics.budget_bytes = budget_bytes;
+    ++frame;
+}
+
+void OpenGL::TextureStreamer::setBudget(std::size_t budget_bytes) noexcept {
+    this->budget_bytes = budget_bytes;
+}
+
+const OpenGL::TextureStreamer::Statistics &OpenGL::TextureStreamer::getStatistics() const noexcept {
+    return statistics;
+}
@@ -0,0 +1,286 @@
+//
+// Created by gomkyung2 on 2026/10/19.
+//
+
+#include "OpenGLApp/TransformHierarchy.hpp"
+
+#include <algorithm>
+#include <cassert>
+#include <numeric>
+
+#include <glm/gtc/quaternion.hpp>
+
+namespace{
+    // Levels smaller than this are computed in the calling thread, since dispatching them costs more than computing.
+    constexpr std::size_t chunk_size = 512;
+
+    template <typename T>
+    void permute(std::vector<T> &values, std::span<const std::uint32_t> order){
+        std::vector<T> result;
+        result.reserve(order.size());
+        for (std::uint32_t index : order){
+            result.push_back(std::move(values[index]));
+        }
+        values = std::move(result);
+    }
+
+    glm::mat4 composeTransform(const glm::vec3 &translation, const glm::quat &rotation, const glm::vec3 &scale) noexcept {
+        // T * R * S, without the general matrix products.
+        glm::mat4 result = glm::mat4_cast(rotation);
+        result[0] *= scale.x;
+        result[1] *= scale.y;
+        result[2] *= scale.z;
+        result[3] = glm::vec4 { translation, 1.f };
+        return result;
+    }
+}
+
+std::uint32_t OpenGL::TransformHierarchy::indexOf(Node node) const noexcept {
+    assert(node < node_indices.size() && node_indices[node] != invalid_index && "Invalid node.");
+    return node_indices[node];
+}
+
+void OpenGL::TransformHierarchy::reorder(std::span<const std::uint32_t> order) {
+    std::vector<std::uint32_t> new_indices(nodes.size(), invalid_index);
+    for (std::uint32_t new_index = 0; new_index < order.size(); ++new_index){
+        new_indices[order[new_index]] = new_index;
+    }
+
+    // Dropped nodes are freed.
+    for (std::uint32_t index = 0; index < nodes.size(); ++index){
+        if (new_indices[index] == invalid_index){
+            node_indices[nodes[index]] = invalid_index;
+            free_nodes.push_back(nodes[index]);
+        }
+    }
+
+    permute(nodes, order);
+    permute(parents, order);
+    permute(depths, order);
+    permute(translations, order);
+    permute(rotations, order);
+    permute(scales, order);
+    permute(dirty_flags, order);
+    permute(world_matrices, order);
+
+    for (std::uint32_t index = 0; index < nodes.size(); ++index){
+        node_indices[nodes[index]] = index;
+        if (parents[index] != invalid_index){
+            parents[index] = new_indices[parents[index]];
+        }
+    }
+
+    structure_changed = true;
+}
+
+void OpenGL::TransformHierarchy::sortByDepth() {
+    // Counting sort, which keeps the order of the nodes in the same level.
+    const std::uint32_t level_count = depths.empty() ? 0 : *std::ranges::max_element(depths) + 1;
+    std::vector<std::uint32_t> offsets(level_count + 1, 0);
+    for (std::uint32_t depth : depths){
+        ++offsets[depth + 1];
+    }
+    std::partial_sum(offsets.begin(), offsets.end(), offsets.begin());
+
+    std::vector<std::uint32_t> order(nodes.size());
+    for (std::uint32_t index = 0; index < nodes.size(); ++index){
+        order[offsets[depths[index]]++] = index;
+    }
+
+    reorder(order);
+    rebuildLevels();
+    sorted = true;
+}
+
+void OpenGL::TransformHierarchy::rebuildLevels() {
+    level_offsets.assign(1, 0);
+    for (std::size_t index = 0; index < depths.size(); ++index){
+        if (depths[index] == level_offsets.size() - 1){
+            level_offsets.push_back(index + 1);
+        }
+        else{
+            level_offsets.back() = index + 1;
+        }
+    }
+}
+
+OpenGL::TransformHierarchy::Node OpenGL::TransformHierarchy::add(Node parent) {
+    return add(Transform{}, parent);
+}
+
+OpenGL::TransformHierarchy::Node OpenGL::TransformHierarchy::add(const Transform &local, Node parent) {
+    const std::uint32_t parent_index = parent == no_parent ? invalid_index : indexOf(parent);
+    const std::uint32_t depth = parent == no_parent ? 0 : depths[parent_index] + 1;
+
+    Node node;
+    if (free_nodes.empty()){
+        node = static_cast<Node>(node_indices.size());
+        node_indices.push_back(invalid_index);
+    }
+    else{
+        node = free_nodes.back();
+        free_nodes.pop_back();
+    }
+
+    const auto index = static_cast<std::uint32_t>(nodes.size());
+    node_indices[node] = index;
+    nodes.push_back(node);
+    parents.push_back(parent_index);
+    depths.push_back(depth);
+    translations.push_back(local.translation);
+    rotations.push_back(local.rotation);
+    scales.push_back(local.scale);
+    dirty_flags.push_back(local_dirty);
+    world_matrices.emplace_back(1.f);
+
+    // Appending to the deepest level or a new level keeps the order.
+    if (sorted){
+        if (const std::size_t level_count = level_offsets.size() - 1; depth == level_count){
+            level_offsets.push_back(index + 1);
+        }
+        else if (depth + 1 == level_count){
+            level_offsets.back() = index + 1;
+        }
+        else{
+            sorted = false;
+        }
+    }
+
+    return node;
+}
+
+void OpenGL::TransformHierarchy::remove(Node node) {
+    // Descendants come after their ancestors only in the sorted order.
+    if (!sorted){
+        sortByDepth();
+    }
+
+    const std::uint32_t root = indexOf(node);
+    std::vector<std::uint8_t> removed(nodes.size(), 0);
+    removed[root] = 1;
+    for (std::uint32_t index = root + 1; index < nodes.size(); ++index){
+        removed[index] = parents[index] != invalid_index && removed[parents[index]];
+    }
+
+    std::vector<std::uint32_t> order;
+    order.reserve(nodes.size());
+    for (std::uint32_t index = 0; index < nodes.size(); ++index){
+        if (!removed[index]){
+            order.push_back(index);
+        }
+    }
+
+    reorder(order);
+    rebuildLevels();
+}
+
+void OpenGL::TransformHierarchy::setTranslation(Node node, const glm::vec3 &translation) noexcept {
+    const std::uint32_t index = indexOf(node);
+    translations[index] = translation;
+    dirty_flags[index] |= local_dirty;
+}
+
+void OpenGL::TransformHierarchy::setRotation(Node node, const glm::quat &rotation) noexcept {
+    const std::uint32_t index = indexOf(node);
+    rotations[index] = rotation;
+    dirty_flags[index] |= local_dirty;
+}
+
+void OpenGL::TransformHierarchy::setScale(Node node, const glm::vec3 &scale) noexcept {
+    const std::uint32_t index = indexOf(node);
+    scales[index] = scale;
+    dirty_flags[index] |= local_dirty;
+}
+
+void OpenGL::TransformHierarchy::setLocal(Node node, const Transform &local) noexcept {
+    const std::uint32_t index = indexOf(node);
+    translations[index] = local.translation;
+    rotations[index] = local.rotation;
+    scales[index] = local.scale;
+    dirty_flags[index] |= local_dirty;
+}
+
+OpenGL::TransformHierarchy::Transform OpenGL::TransformHierarchy::getLocal(Node node) const noexcept {
+    const std::uint32_t index = indexOf(node);
+    return { translations[index], rotations[index], scales[index] };
+}
+
+OpenGL::TransformHierarchy::Node OpenGL::TransformHierarchy::getParent(Node node) const noexcept {
+    const std::uint32_t parent_index = parents[indexOf(node)];
+    return parent_index == invalid_index ? no_parent : nodes[parent_index];
+}
+
+void OpenGL::TransformHierarchy::update(Utils::ThreadPool &thread_pool) {
+    if (!sorted){
+        sortByDepth();
+    }
+
+    std::size_t changed_begin = nodes.size(), changed_end = 0;
+    std::vector<std::pair<std::size_t, std::size_t>> chunk_ranges;
+    for (std::size_t level = 0; level + 1 < level_offsets.size(); ++level){
+        const std::size_t level_begin = level_offsets[level], level_end = level_offsets[level + 1];
+        const std::size_t chunk_count = (level_end - level_begin + chunk_size - 1) / chunk_size;
+
+        // A node is recomputed if its local transform or its parent's world matrix is changed. Parents are in the
+        // previous levels, which are already finished.
+        chunk_ranges.assign(chunk_count, { nodes.size(), 0 });
+        const auto update_chunk = [&](std::size_t chunk){
+            const std::size_t begin = level_begin + chunk * chunk_size, end = std::min(begin + chunk_size, level_end);
+            auto &[range_begin, range_end] = chunk_ranges[chunk];
+            for (std::size_t index = begin; index < end; ++index){
+                const std::uint32_t parent = parents[index];
+                if (!(dirty_flags[index] & local_dirty) && (parent == invalid_index || !(dirty_flags[parent] & world_changed))){
+                    dirty_flags[index] = 0;
+                    continue;
+                }
+
+                const glm::mat4 local = composeTransform(translations[index], rotations[index], scales[index]);
+                world_matrices[index] = parent == invalid_index ? local : world_matrices[parent] * local;
+                dirty_flags[index] = world_changed;
+
+                range_begin = std::min(range_begin, index);
+                range_end = index + 1;
+            }
+        };
+
+        if (chunk_count == 1){
+            update_chunk(0);
+        }
+        else{
+            thread_pool.parallelFor(chunk_count, update_chunk);
+        }
+
+        for (const auto &[range_begin, range_end] : chunk_ranges){
+            changed_begin = std::min(changed_begin, range_begin);
+            changed_end = std::max(changed_end, range_end);
+        }
+    }
+
+    if (structure_changed){
+        changed_range = { 0, nodes.size() };
+        structure_changed = false;
+    }
+    else{
+        changed_range = changed_begin < changed_end ? std::pair { changed_begin, changed_end } : std::pair<std::size_t, std::size_t> { 0, 0 };
+    }
+}
+
+std::span<const glm::mat4> OpenGL::TransformHierarchy::getWorldMatrices() const noexcept {
+    return world_matrices;
+}
+
+const glm::mat4 &OpenGL::TransformHierarchy::getWorldMatrix(Node node) const noexcept {
+    return world_matrices[indexOf(node)];
+}
+
+std::size_t OpenGL::TransformHierarchy::getIndex(Node node) const noexcept {
+    return indexOf(node);
+}
+
+std::pair<std::size_t, std::size_t> OpenGL::TransformHierarchy::getChangedRange() const noexcept {
+    return changed_range;
+}
+
+std::size_t OpenGL::TransformHierarchy::size() const noexcept {
+    return nodes.size();
+}
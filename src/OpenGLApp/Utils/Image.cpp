@@ -4,35 +4,334 @@
 
 #include "OpenGLApp/Utils/Image.hpp"
 
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdlib>
+#include <limits>
+#include <optional>
 #include <stdexcept>
+#include <utility>
 
+#include "OpenGLApp/Utils/MappedFile.hpp"
+
+namespace{
+    // Allocator of the image being decoded in this thread, which is used by stb_image through the macros below.
+    thread_local OpenGL::Utils::ImageAllocator *current_allocator = nullptr;
+
+    void *allocateImageMemory(std::size_t size) noexcept {
+        return current_allocator ? current_allocator->allocate(size) : std::malloc(size);
+    }
+
+    void *reallocateImageMemory(void *pointer, std::size_t old_size, std::size_t new_size) noexcept {
+        return current_allocator ? current_allocator->reallocate(pointer, old_size, new_size) : std::realloc(pointer, new_size);
+    }
+
+    void deallocateImageMemory(void *pointer) noexcept {
+        current_allocator ? current_allocator->deallocate(pointer) : std::free(pointer);
+    }
+
+    // Set the current allocator in the scope.
+    class AllocatorScope{
+    private:
+        OpenGL::Utils::ImageAllocator *previous;
+
+    public:
+        explicit AllocatorScope(OpenGL::Utils::ImageAllocator *allocator) noexcept : previous { std::exchange(current_allocator, allocator) } {
+
+        }
+
+        AllocatorScope(const AllocatorScope&) = delete;
+
+        ~AllocatorScope() noexcept {
+            current_allocator = previous;
+        }
+    };
+}
+
+#define STBI_MALLOC(size) allocateImageMemory(size)
+#define STBI_REALLOC_SIZED(pointer, old_size, new_size) reallocateImageMemory(pointer, old_size, new_size)
+#define STBI_FREE(pointer) deallocateImageMemory(pointer)
 #define STB_IMAGE_IMPLEMENTATION
 #include "stb_image.h"
 
-OpenGL::Utils::Image::Image(int width, int height, int channels, const unsigned char *data) noexcept : width { width }, height { height }, channels { channels }, data { data } {
+#if defined(__SSE2__) || defined(_M_X64)
+#define OPENGLAPP_IMAGE_SSE2
+#include <emmintrin.h>
+#endif
+
+// SSSE3 is not in the x86-64 baseline, so it is compiled for the function only and selected at run time.
+#if defined(OPENGLAPP_IMAGE_SSE2) && (defined(__GNUC__) || defined(__clang__))
+#define OPENGLAPP_IMAGE_SSSE3
+#include <tmmintrin.h>
+#endif
+
+namespace{
+    using PixelLayout = OpenGL::Utils::Image::PixelLayout;
+
+    int getChannelCount(PixelLayout layout) noexcept {
+        switch (layout){
+            case PixelLayout::R: return 1;
+            case PixelLayout::Rg: return 2;
+            case PixelLayout::Rgb: return 3;
+            default: return 4;
+        }
+    }
+
+    PixelLayout getOriginalLayout(int channels) noexcept {
+        constexpr std::array layouts { PixelLayout::R, PixelLayout::Rg, PixelLayout::Rgb, PixelLayout::Rgba };
+        return layouts[channels - 1];
+    }
 
+#ifdef OPENGLAPP_IMAGE_SSSE3
+    __attribute__((target("ssse3")))
+    std::size_t convertRgbToRgbaSsse3(const unsigned char *source, unsigned char *destination, std::size_t pixel_count, bool bgra) noexcept {
+        const __m128i shuffle = bgra
+            ? _mm_setr_epi8(2, 1, 0, -1, 5, 4, 3, -1, 8, 7, 6, -1, 11, 10, 9, -1)
+            : _mm_setr_epi8(0, 1, 2, -1, 3, 4, 5, -1, 6, 7, 8, -1, 9, 10, 11, -1);
+        const __m128i alpha = _mm_set1_epi32(static_cast<int>(0xFF000000));
+
+        // 16 bytes are loaded for 4 pixels (12 bytes), so the last 2 pixels are left to the scalar loop.
+        std::size_t pixel = 0;
+        for (; pixel + 6 <= pixel_count; pixel += 4){
+            const __m128i rgb = _mm_loadu_si128(reinterpret_cast<const __m128i*>(source + 3 * pixel));
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(destination + 4 * pixel), _mm_or_si128(_mm_shuffle_epi8(rgb, shuffle), alpha));
+        }
+        return pixel;
+    }
+#endif
+
+    void convertRgbToRgba(const unsigned char *source, unsigned char *destination, std::size_t pixel_count, bool bgra) noexcept {
+        std::size_t pixel = 0;
+#ifdef OPENGLAPP_IMAGE_SSSE3
+        if (__builtin_cpu_supports("ssse3")){
+            pixel = convertRgbToRgbaSsse3(source, destination, pixel_count, bgra);
+        }
+#endif
+        for (; pixel < pixel_count; ++pixel){
+            const unsigned char *in = source + 3 * pixel;
+            unsigned char *out = destination + 4 * pixel;
+            out[0] = in[bgra ? 2 : 0];
+            out[1] = in[1];
+            out[2] = in[bgra ? 0 : 2];
+            out[3] = 255;
+        }
+    }
+
+    void convertRgbaToBgra(const unsigned char *source, unsigned char *destination, std::size_t pixel_count) noexcept {
+        std::size_t pixel = 0;
+#ifdef OPENGLAPP_IMAGE_SSE2
+        // Swap the 1st and 3rd bytes of each 32-bit pixel.
+        const __m128i green_alpha_mask = _mm_set1_epi32(static_cast<int>(0xFF00FF00)), byte_mask = _mm_set1_epi32(0xFF);
+        for (; pixel + 4 <= pixel_count; pixel += 4){
+            const __m128i rgba = _mm_loadu_si128(reinterpret_cast<const __m128i*>(source + 4 * pixel));
+            const __m128i red = _mm_slli_epi32(_mm_and_si128(rgba, byte_mask), 16);
+            const __m128i blue = _mm_and_si128(_mm_srli_epi32(rgba, 16), byte_mask);
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(destination + 4 * pixel), _mm_or_si128(_mm_and_si128(rgba, green_alpha_mask), _mm_or_si128(red, blue)));
+        }
+#endif
+        for (; pixel < pixel_count; ++pixel){
+            const unsigned char *in = source + 4 * pixel;
+            unsigned char *out = destination + 4 * pixel;
+            out[0] = in[2];
+            out[1] = in[1];
+            out[2] = in[0];
+            out[3] = in[3];
+        }
+    }
+
+    // Any other conversion, which is rare enough to be done per channel. Gray is computed the same as stb_image.
+    void convertGeneric(const unsigned char *source, int source_channels, unsigned char *destination, PixelLayout layout, std::size_t pixel_count) noexcept {
+        for (std::size_t pixel = 0; pixel < pixel_count; ++pixel){
+            const unsigned char *in = source + pixel * source_channels;
+            std::array<unsigned char, 4> rgba;
+            switch (source_channels){
+                case 1: rgba = { in[0], in[0], in[0], 255 }; break;
+                case 2: rgba = { in[0], in[0], in[0], in[1] }; break;
+                case 3: rgba = { in[0], in[1], in[2], 255 }; break;
+                default: rgba = { in[0], in[1], in[2], in[3] }; break;
+            }
+            const auto gray = static_cast<unsigned char>((rgba[0] * 77 + rgba[1] * 150 + rgba[2] * 29) >> 8);
+
+            switch (layout){
+                case PixelLayout::R:
+                    *destination++ = gray;
+                    break;
+                case PixelLayout::Rg:
+                    *destination++ = gray;
+                    *destination++ = rgba[3];
+                    break;
+                case PixelLayout::Rgb:
+                    destination = std::copy_n(rgba.data(), 3, destination);
+                    break;
+                case PixelLayout::Bgra:
+                    std::swap(rgba[0], rgba[2]);
+                    [[fallthrough]];
+                default:
+                    destination = std::copy_n(rgba.data(), 4, destination);
+                    break;
+            }
+        }
+    }
 }
 
-OpenGL::Utils::Image OpenGL::Utils::Image::from(const char *filename) {
+OpenGL::Utils::Image::Image(int width, int height, int channels, unsigned char *data, PixelLayout layout, ColorSpace color_space, ImageAllocator *allocator) noexcept
+        : width { width }, height { height }, channels { channels }, data { data }, layout { layout }, color_space { color_space }, allocator { allocator } {
+
+}
+
+OpenGL::Utils::Image OpenGL::Utils::Image::from(std::span<const std::byte> encoded, LoadOptions options, ImageAllocator *allocator) {
+    if (encoded.size() > static_cast<std::size_t>(std::numeric_limits<int>::max())){
+        throw std::runtime_error { "Image file is too large." };
+    }
+
+    // Both the decoder's temporary buffers and the result are allocated by allocator.
+    const AllocatorScope allocator_scope { allocator };
+
     int width, height, channels;
-    unsigned char *data = stbi_load(filename, &width, &height, &channels, 0);
+    unsigned char *data = stbi_load_from_memory(reinterpret_cast<const stbi_uc*>(encoded.data()), static_cast<int>(encoded.size()), &width, &height, &channels, 0);
     if (!data){
         throw std::runtime_error { "Failed to load image." };
     }
 
-    return { width, height, channels, data };
+    const PixelLayout source_layout = getOriginalLayout(channels);
+    if (options.layout == PixelLayout::Original || options.layout == source_layout){
+        return { width, height, channels, data, source_layout, options.color_space, allocator };
+    }
+
+    const int converted_channels = getChannelCount(options.layout);
+    const std::size_t pixel_count = static_cast<std::size_t>(width) * height;
+    auto *converted = static_cast<unsigned char*>(STBI_MALLOC(pixel_count * converted_channels));
+    if (!converted){
+        stbi_image_free(data);
+        throw std::runtime_error { "Failed to allocate converted image." };
+    }
+
+    if (source_layout == PixelLayout::Rgb && (options.layout == PixelLayout::Rgba || options.layout == PixelLayout::Bgra)){
+        convertRgbToRgba(data, converted, pixel_count, options.layout == PixelLayout::Bgra);
+    }
+    else if (source_layout == PixelLayout::Rgba && options.layout == PixelLayout::Bgra){
+        convertRgbaToBgra(data, converted, pixel_count);
+    }
+    else{
+        convertGeneric(data, channels, converted, options.layout, pixel_count);
+    }
+    stbi_image_free(data);
+
+    return { width, height, converted_channels, converted, options.layout, options.color_space, allocator };
+}
+
+OpenGL::Utils::Image::Info OpenGL::Utils::Image::readInfo(const char *filename) {
+    const MappedFile file { filename };
+    const std::span<const std::byte> encoded = file.getBytes();
+    if (encoded.size() > static_cast<std::size_t>(std::numeric_limits<int>::max())){
+        throw std::runtime_error { "Image file is too large." };
+    }
+
+    Info info;
+    if (!stbi_info_from_memory(reinterpret_cast<const stbi_uc*>(encoded.data()), static_cast<int>(encoded.size()), &info.width, &info.height, &info.channels)){
+        throw std::runtime_error { "Failed to read image information." };
+    }
+    return info;
+}
+
+OpenGL::Utils::Image::Image(const char *filename, LoadOptions options, ImageAllocator *allocator)
+        : Image { from(MappedFile { filename }.getBytes(), options, allocator) } {
+
+}
+
+OpenGL::Utils::Image::Image(std::span<const std::byte> encoded, LoadOptions options, ImageAllocator *allocator)
+        : Image { from(encoded, options, allocator) } {
+
 }
 
-OpenGL::Utils::Image::Image(const char *filename) : Image { from(filename) } {
+OpenGL::Utils::Image::Image(Image &&source) noexcept
+        : width { source.width }, height { source.height }, channels { source.channels }, data { std::exchange(source.data, nullptr) },
+          layout { source.layout }, color_space { source.color_space }, allocator { source.allocator } {
 
 }
 
-OpenGL::Utils::Image::Image(Image &&source) noexcept : width { source.width }, height { source.height }, channels { source.channels }, data { source.data } {
-    source.data = nullptr;
+OpenGL::Utils::Image &OpenGL::Utils::Image::operator=(Image &&source) noexcept {
+    if (this != &source){
+        const AllocatorScope allocator_scope { allocator };
+        deallocateImageMemory(data);
+
+        width = source.width;
+        height = source.height;
+        channels = source.channels;
+        data = std::exchange(source.data, nullptr);
+        layout = source.layout;
+        color_space = source.color_space;
+        allocator = source.allocator;
+    }
+    return *this;
 }
 
 OpenGL::Utils::Image::~Image() noexcept {
-    if (data){
-        stbi_image_free(const_cast<unsigned char *>(data));
+    const AllocatorScope allocator_scope { allocator };
+    deallocateImageMemory(data);
+}
+
+std::vector<OpenGL::Utils::Image> OpenGL::Utils::Image::load(std::span<const char* const> filenames, LoadOptions options, ImageAllocator &allocator, ThreadPool &thread_pool) {
+    std::vector<std::optional<Image>> decoded(filenames.size());
+    thread_pool.parallelFor(filenames.size(), [&](std::size_t index){
+        decoded[index].emplace(filenames[index], options, &allocator);
+    });
+
+    std::vector<Image> images;
+    images.reserve(decoded.size());
+    for (std::optional<Image> &image : decoded){
+        images.push_back(std::move(*image));
     }
-}
\ No newline at end of file
+    return images;
+}
+
+int OpenGL::Utils::Image::getWidth() const noexcept {
+    return width;
+}
+
+int OpenGL::Utils::Image::getHeight() const noexcept {
+    return height;
+}
+
+int OpenGL::Utils::Image::getChannels() const noexcept {
+    return channels;
+}
+
+const unsigned char *OpenGL::Utils::Image::getData() const noexcept {
+    return data;
+}
+
+OpenGL::Utils::Image::PixelLayout OpenGL::Utils::Image::getLayout() const noexcept {
+    return layout;
+}
+
+OpenGL::Utils::Image::ColorSpace OpenGL::Utils::Image::getColorSpace() const noexcept {
+    return color_space;
+}
+
+OpenGL::Utils::Image::GLFormat OpenGL::Utils::Image::getGLFormat() const noexcept {
+    const bool srgb = color_space == ColorSpace::Srgb;
+    switch (layout){
+        case PixelLayout::R:
+            return { GL_R8, GL_RED, GL_UNSIGNED_BYTE };
+        case PixelLayout::Rg:
+            return { GL_RG8, GL_RG, GL_UNSIGNED_BYTE };
+        case PixelLayout::Rgb:
+            return { static_cast<GLenum>(srgb ? GL_SRGB8 : GL_RGB8), GL_RGB, GL_UNSIGNED_BYTE };
+        case PixelLayout::Bgra:
+            return { static_cast<GLenum>(srgb ? GL_SRGB8_ALPHA8 : GL_RGBA8), GL_BGRA, GL_UNSIGNED_INT_8_8_8_8_REV };
+        default:
+            return { static_cast<GLenum>(srgb ? GL_SRGB8_ALPHA8 : GL_RGBA8), GL_RGBA, GL_UNSIGNED_BYTE };
+    }
+}
+
+GLint OpenGL::Utils::Image::getRowAlignment() const noexcept {
+    const std::size_t row_size = static_cast<std::size_t>(width) * channels;
+    for (GLint alignment : { 8, 4, 2 }){
+        if (row_size % alignment == 0){
+            return alignment;
+        }
+    }
+    return 1;
+}
@@ -0,0 +1,95 @@
+//
+// Created by gomkyung2 on 2026/10/19.
+//
+
+#include "OpenGLApp/Utils/ImageAllocator.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <cstdlib>
+#include <cstring>
+#include <new>
+
+void *OpenGL::Utils::ImageAllocator::reallocate(void *pointer, std::size_t old_size, std::size_t new_size) noexcept {
+    void *const result = allocate(new_size);
+    if (result && pointer){
+        std::memcpy(result, pointer, std::min(old_size, new_size));
+        deallocate(pointer);
+    }
+    return result;
+}
+
+OpenGL::Utils::PoolImageAllocator::~PoolImageAllocator() noexcept {
+    trim();
+}
+
+void *OpenGL::Utils::PoolImageAllocator::allocate(std::size_t size) noexcept {
+    const std::size_t size_class = std::max<std::size_t>(std::bit_width(std::max<std::size_t>(size, 1) - 1), min_size_class);
+    if (size_class - min_size_class >= size_class_count){
+        return nullptr;
+    }
+
+    {
+        std::scoped_lock lock { mutex };
+        if (std::vector<Header*> &blocks = free_blocks[size_class - min_size_class]; !blocks.empty()){
+            Header *const header = blocks.back();
+            blocks.pop_back();
+            return header + 1;
+        }
+    }
+
+    auto *const header = static_cast<Header*>(std::malloc(sizeof(Header) + (std::size_t { 1 } << size_class)));
+    if (!header){
+        return nullptr;
+    }
+    header->size_class = size_class;
+    return header + 1;
+}
+
+void OpenGL::Utils::PoolImageAllocator::deallocate(void *pointer) noexcept {
+    if (!pointer){
+        return;
+    }
+
+    Header *const header = static_cast<Header*>(pointer) - 1;
+    try{
+        std::scoped_lock lock { mutex };
+        free_blocks[header->size_class - min_size_class].push_back(header);
+    }
+    catch (const std::bad_alloc&){
+        std::free(header);
+    }
+}
+
+void OpenGL::Utils::PoolImageAllocator::trim() noexcept {
+    std::scoped_lock lock { mutex };
+    for (std::vector<Header*> &blocks : free_blocks){
+        for (Header *header : blocks){
+            std::free(header);
+        }
+        blocks.clear();
+    }
+}
+
+OpenGL::Utils::ArenaImageAllocator::ArenaImageAllocator(std::size_t chunk_size) noexcept : arena { chunk_size } {
+
+}
+
+void *OpenGL::Utils::ArenaImageAllocator::allocate(std::size_t size) noexcept {
+    try{
+        std::scoped_lock lock { mutex };
+        return arena.allocate(size);
+    }
+    catch (const std::bad_alloc&){
+        return nullptr;
+    }
+}
+
+void OpenGL::Utils::ArenaImageAllocator::deallocate(void*) noexcept {
+
+}
+
+void OpenGL::Utils::ArenaImageAllocator::reset() noexcept {
+    std::scoped_lock lock { mutex };
+    arena.reset();
+}
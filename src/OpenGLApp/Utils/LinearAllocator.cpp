@@ -0,0 +1,53 @@
+//
+// Created by gomkyung2 on 2026/10/19.
+//
+
+#include "OpenGLApp/Utils/LinearAllocator.hpp"
+
+#include <algorithm>
+#include <cassert>
+#include <cstdint>
+
+OpenGL::Utils::LinearAllocator::LinearAllocator(std::size_t chunk_size) noexcept : chunk_size { chunk_size } {
+
+}
+
+void *OpenGL::Utils::LinearAllocator::allocate(std::size_t size, std::size_t alignment) {
+    assert(alignment != 0 && (alignment & (alignment - 1)) == 0 && alignment <= alignof(std::max_align_t));
+
+    const auto aligned_offset = [&](const Chunk &chunk, std::size_t offset){
+        const auto address = reinterpret_cast<std::uintptr_t>(chunk.data.get()) + offset;
+        return offset + ((alignment - address % alignment) % alignment);
+    };
+
+    if (chunk_index < chunks.size()){
+        if (const std::size_t begin = aligned_offset(chunks[chunk_index], offset); begin + size <= chunks[chunk_index].size){
+            offset = begin + size;
+            return chunks[chunk_index].data.get() + begin;
+        }
+        ++chunk_index;
+    }
+
+    // Reuse the next chunk if it is large enough, otherwise insert a new one before it. Chunk memory is aligned by
+    // operator new[], so the allocation starts at the beginning of the chunk.
+    if (chunk_index == chunks.size() || chunks[chunk_index].size < size){
+        const std::size_t new_chunk_size = std::max(chunk_size, size);
+        chunks.emplace(chunks.begin() + chunk_index, std::make_unique_for_overwrite<std::byte[]>(new_chunk_size), new_chunk_size);
+    }
+
+    offset = size;
+    return chunks[chunk_index].data.get();
+}
+
+void OpenGL::Utils::LinearAllocator::reset() noexcept {
+    chunk_index = 0;
+    offset = 0;
+}
+
+std::size_t OpenGL::Utils::LinearAllocator::getCapacity() const noexcept {
+    std::size_t capacity = 0;
+    for (const Chunk &chunk : chunks){
+        capacity += chunk.size;
+    }
+    return capacity;
+}
@@ -0,0 +1,93 @@
+//
+// Created by gomkyung2 on 2026/10/19.
+//
+
+#include "OpenGLApp/Utils/MappedFile.hpp"
+
+#include <stdexcept>
+
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#ifdef _WIN32
+OpenGL::Utils::MappedFile::MappedFile(const char *filename) {
+    file_handle = CreateFileA(filename, GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (file_handle == INVALID_HANDLE_VALUE){
+        throw std::runtime_error { "Failed to open file." };
+    }
+
+    LARGE_INTEGER file_size;
+    if (!GetFileSizeEx(file_handle, &file_size)){
+        CloseHandle(file_handle);
+        throw std::runtime_error { "Failed to get file size." };
+    }
+    size = static_cast<std::size_t>(file_size.QuadPart);
+
+    // Empty files cannot be mapped, and there is nothing to read anyway.
+    if (size != 0){
+        mapping_handle = CreateFileMappingA(file_handle, nullptr, PAGE_READONLY, 0, 0, nullptr);
+        if (!mapping_handle || !(data = static_cast<const std::byte*>(MapViewOfFile(mapping_handle, FILE_MAP_READ, 0, 0, 0)))){
+            if (mapping_handle){
+                CloseHandle(mapping_handle);
+            }
+            CloseHandle(file_handle);
+            throw std::runtime_error { "Failed to map file." };
+        }
+    }
+}
+
+OpenGL::Utils::MappedFile::~MappedFile() noexcept {
+    if (data){
+        UnmapViewOfFile(data);
+    }
+    if (mapping_handle){
+        CloseHandle(mapping_handle);
+    }
+    CloseHandle(file_handle);
+}
+#else
+OpenGL::Utils::MappedFile::MappedFile(const char *filename) {
+    const int file_descriptor = open(filename, O_RDONLY);
+    if (file_descriptor == -1){
+        throw std::runtime_error { "Failed to open file." };
+    }
+
+    struct stat file_status;
+    if (fstat(file_descriptor, &file_status) == -1){
+        close(file_descriptor);
+        throw std::runtime_error { "Failed to get file size." };
+    }
+    size = static_cast<std::size_t>(file_status.st_size);
+
+    // Empty files cannot be mapped, and there is nothing to read anyway.
+    if (size != 0){
+        void *const address = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, file_descriptor, 0);
+        if (address == MAP_FAILED){
+            close(file_descriptor);
+            throw std::runtime_error { "Failed to map file." };
+        }
+        data = static_cast<const std::byte*>(address);
+    }
+
+    // The mapping is kept after the descriptor is closed.
+    close(file_descriptor);
+}
+
+OpenGL::Utils::MappedFile::~MappedFile() noexcept {
+    if (data){
+        munmap(const_cast<std::byte*>(data), size);
+    }
+}
+#endif
+
+std::span<const std::byte> OpenGL::Utils::MappedFile::getBytes() const noexcept {
+    return { data, size };
+}
@@ -0,0 +1,87 @@
+//
+// Created by gomkyung2 on 2026/10/19.
+//
+
+#include "OpenGLApp/Utils/SkylinePacker.hpp"
+
+#include <algorithm>
+
+OpenGL::Utils::SkylinePacker::SkylinePacker(int width, int height) : width { width }, height { height } {
+    clear();
+}
+
+std::optional<int> OpenGL::Utils::SkylinePacker::fit(std::size_t segment_index, int rect_width, int rect_height) const {
+    // The rectangle starts at the segment and rests on the highest segment it spans.
+    const int x = skyline[segment_index].x;
+    if (x + rect_width > width){
+        return std::nullopt;
+    }
+
+    int y = 0;
+    for (std::size_t index = segment_index; index < skyline.size() && skyline[index].x < x + rect_width; ++index){
+        y = std::max(y, skyline[index].y);
+    }
+    if (y + rect_height > height){
+        return std::nullopt;
+    }
+    return y;
+}
+
+std::optional<glm::ivec2> OpenGL::Utils::SkylinePacker::pack(int rect_width, int rect_height) {
+    std::optional<std::size_t> best_index;
+    int best_x = 0, best_y = 0;
+    for (std::size_t index = 0; index < skyline.size(); ++index){
+        const std::optional<int> y = fit(index, rect_width, rect_height);
+        if (y && (!best_index || *y < best_y)){
+            best_index = index;
+            best_x = skyline[index].x;
+            best_y = *y;
+        }
+    }
+    if (!best_index){
+        return std::nullopt;
+    }
+
+    // Insert the top edge of the rectangle, and shrink or remove the segments under it.
+    skyline.insert(skyline.begin() + *best_index, Segment { best_x, best_y + rect_height, rect_width });
+    const int right = best_x + rect_width;
+    for (std::size_t index = *best_index + 1; index < skyline.size();){
+        Segment &segment = skyline[index];
+        if (segment.x >= right){
+            break;
+        }
+
+        const int overlap = right - segment.x;
+        if (overlap >= segment.width){
+            skyline.erase(skyline.begin() + index);
+        }
+        else{
+            segment.x += overlap;
+            segment.width -= overlap;
+            break;
+        }
+    }
+
+    // Merge the adjacent segments of the same height.
+    for (std::size_t index = 0; index + 1 < skyline.size();){
+        if (skyline[index].y == skyline[index + 1].y){
+            skyline[index].width += skyline[index + 1].width;
+            skyline.erase(skyline.begin() + index + 1);
+        }
+        else{
+            ++index;
+        }
+    }
+
+    used_area += static_cast<long long>(rect_width) * rect_height;
+    return glm::ivec2 { best_x, best_y };
+}
+
+void OpenGL::Utils::SkylinePacker::clear() {
+    skyline.assign(1, Segment { 0, 0, width });
+    used_area = 0;
+}
+
+float OpenGL::Utils::SkylinePacker::getOccupancy() const noexcept {
+    return static_cast<float>(used_area) / (static_cast<float>(width) * static_cast<float>(height));
+}
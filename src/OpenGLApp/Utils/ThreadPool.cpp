@@ -0,0 +1,93 @@
+//
+// Created by gomkyung2 on 2026/10/19.
+//
+
+#include "OpenGLApp/Utils/ThreadPool.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <latch>
+
+void OpenGL::Utils::ThreadPool::workerMain(std::stop_token stop_token) {
+    while (true){
+        std::function<void()> task;
+        {
+            std::unique_lock lock { mutex };
+            if (!condition.wait(lock, stop_token, [this] { return !tasks.empty(); })){
+                return;
+            }
+
+            task = std::move(tasks.front());
+            tasks.pop_front();
+        }
+        task();
+    }
+}
+
+OpenGL::Utils::ThreadPool::ThreadPool(unsigned int thread_count) {
+    workers.reserve(thread_count);
+    for (unsigned int index = 0; index < thread_count; ++index){
+        workers.emplace_back([this](std::stop_token stop_token) { workerMain(std::move(stop_token)); });
+    }
+}
+
+OpenGL::Utils::ThreadPool::~ThreadPool() noexcept {
+    for (std::jthread &worker : workers){
+        worker.request_stop();
+    }
+}
+
+void OpenGL::Utils::ThreadPool::parallelFor(std::size_t count, const std::function<void(std::size_t)> &function) {
+    if (count == 0){
+        return;
+    }
+
+    // Every participant takes the next index until all indices are taken, so uneven iterations are balanced.
+    std::atomic<std::size_t> next_index { 0 };
+    std::exception_ptr exception;
+    std::mutex exception_mutex;
+    const auto run = [&]{
+        for (std::size_t index; (index = next_index.fetch_add(1, std::memory_order_relaxed)) < count;){
+            try{
+                function(index);
+            }
+            catch (...){
+                std::scoped_lock lock { exception_mutex };
+                if (!exception){
+                    exception = std::current_exception();
+                }
+                next_index.store(count, std::memory_order_relaxed);
+            }
+        }
+    };
+
+    const std::size_t helper_count = std::min(workers.size(), count - 1);
+    std::latch helpers_done { static_cast<std::ptrdiff_t>(helper_count) };
+    {
+        std::scoped_lock lock { mutex };
+        for (std::size_t helper = 0; helper < helper_count; ++helper){
+            tasks.emplace_back([&]{
+                run();
+                helpers_done.count_down();
+            });
+        }
+    }
+    condition.notify_all();
+
+    run();
+    helpers_done.wait();
+
+    if (exception){
+        std::rethrow_exception(exception);
+    }
+}
+
+std::size_t OpenGL::Utils::ThreadPool::getThreadCount() const noexcept {
+    return workers.size();
+}
+
+OpenGL::Utils::ThreadPool &OpenGL::Utils::ThreadPool::getDefault() {
+    static ThreadPool thread_pool;
+    return thread_pool;
+}
@@ -4,22 +4,57 @@
 
 #include "OpenGLApp/Window.hpp"
 
+#include "OpenGLApp/Capabilities.hpp"
+#include "OpenGLApp/GLIntercept.hpp"
+#include "OpenGLApp/GLObject.hpp"
+#include "OpenGLApp/GoldenImageTest.hpp"
+
 #include <stdexcept>
+#include <chrono>
+#include <cmath>
+#include <exception>
+#include <functional>
+#include <iterator>
+#include <semaphore>
+#include <string>
+#include <thread>
+#include <utility>
+
+#include <glm/common.hpp>
 
 namespace{
-    GLFWwindow *createGlfwWindow(int width, int height, const char *title){
+    GLFWwindow *createGlfwWindow(int width, int height, const char *title, const OpenGL::Window::ContextSettings &settings){
+        // The library uses 3.3 features unconditionally, and a driver may create exactly the requested earlier version.
+        if (std::pair { settings.major_version, settings.minor_version } < std::pair { 3, 3 }){
+            throw std::runtime_error {
+                "Requested OpenGL context version " + std::to_string(settings.major_version) + "." +
+                std::to_string(settings.minor_version) + " is earlier than 3.3, the minimum version the library supports."
+            };
+        }
+
         if (!glfwInit()){
             throw std::runtime_error { "Failed to initialize GLFW" };
         }
 
-        glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, 3);
-        glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, 3);
-        glfwWindowHint(GLFW_OPENGL_PROFILE, GLFW_OPENGL_CORE_PROFILE);
+        // Versions tried after the requested one, in order. Drivers may create a later version than requested, but
+        // never an earlier one.
+        constexpr std::pair<int, int> fallback_versions[] { { 4, 6 }, { 4, 5 }, { 4, 4 }, { 4, 3 }, { 4, 2 }, { 4, 1 }, { 4, 0 }, { 3, 3 } };
+        const auto try_create = [&](int major_version, int minor_version) -> GLFWwindow* {
+            glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, major_version);
+            glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, minor_version);
+            glfwWindowHint(GLFW_OPENGL_PROFILE, settings.core_profile ? GLFW_OPENGL_CORE_PROFILE : GLFW_OPENGL_COMPAT_PROFILE);
 #ifdef __APPLE__
-        glfwWindowHint(GLFW_OPENGL_FORWARD_COMPAT, GL_TRUE);
+            glfwWindowHint(GLFW_OPENGL_FORWARD_COMPAT, GL_TRUE);
 #endif
+            return glfwCreateWindow(width, height, title, nullptr, nullptr);
+        };
 
-        GLFWwindow* window = glfwCreateWindow(width, height, title, nullptr, nullptr);
+        GLFWwindow* window = try_create(settings.major_version, settings.minor_version);
+        for (auto it = std::begin(fallback_versions); !window && it != std::end(fallback_versions); ++it){
+            if (*it < std::pair { settings.major_version, settings.minor_version }){
+                window = try_create(it->first, it->second);
+            }
+        }
         if (!window){
             glfwTerminate();
             throw std::runtime_error { "Failed to create GLFW window" };
@@ -27,6 +62,77 @@ namespace{
 
         return window;
     }
+
+    /**
+     * @brief Worker thread which runs the update function of the next frame while the GL thread is drawing.
+     * @note \p request() and \p wait() must be called alternately. An exception thrown by the update function is
+     * rethrown in \p wait() , i.e. in the GL thread.
+     */
+    class UpdateWorker{
+    private:
+        std::function<float(float)> update_function; // Returns the interpolation alpha of the updated frame.
+        std::binary_semaphore update_requested { 0 }, update_finished { 0 };
+        float time_delta = 0.f, interpolation_alpha = 1.f;
+        std::exception_ptr exception;
+        bool in_flight = false; // Whether an update is requested but not waited yet. Only accessed by the GL thread.
+        std::jthread thread; // Must be declared last, since the thread uses the members above.
+
+        void threadMain(std::stop_token stop_token){
+            while (true){
+                update_requested.acquire();
+                if (stop_token.stop_requested()){
+                    return;
+                }
+
+                try{
+                    interpolation_alpha = update_function(time_delta);
+                }
+                catch (...){
+                    exception = std::current_exception();
+                }
+                update_finished.release();
+            }
+        }
+
+    public:
+        explicit UpdateWorker(std::function<float(float)> update_function)
+                : update_function { std::move(update_function) },
+                  thread { [this](std::stop_token stop_token) { threadMain(std::move(stop_token)); } }
+        {
+
+        }
+
+        ~UpdateWorker() noexcept{
+            // If the GL thread is unwinding between request() and wait() (e.g. draw threw), the requested update must
+            // finish first, otherwise update_requested would be released twice. Its exception is discarded.
+            if (in_flight){
+                update_finished.acquire();
+            }
+
+            // Wake up the thread which is waiting for the next request, then it checks the stop token and finishes.
+            thread.request_stop();
+            update_requested.release();
+        }
+
+        void request(float time_delta_){
+            time_delta = time_delta_;
+            in_flight = true;
+            update_requested.release();
+        }
+
+        float wait(){
+            update_finished.acquire();
+            in_flight = false;
+            if (exception){
+                std::rethrow_exception(std::exchange(exception, nullptr));
+            }
+            return interpolation_alpha;
+        }
+    };
+}
+
+void OpenGL::Window::publishRenderState() {
+
 }
 
 void OpenGL::Window::onWindowSizeChanged(int width, int height) {
@@ -55,17 +161,27 @@ void OpenGL::Window::onScrollChanged(double xoffset, double yoffset) {
 }
 
 OpenGL::Window::Window(int width, int height, const char *title)
-        : window { createGlfwWindow(width, height, title) },
+        : Window { width, height, title, ContextSettings {} }
+{
+
+}
+
+OpenGL::Window::Window(int width, int height, const char *title, const ContextSettings &context_settings)
+        : window { createGlfwWindow(width, height, title, context_settings) },
           size { width, height }
 {
     glfwMakeContextCurrent(window);
-    glfwSwapInterval(1);
+    setPresentMode(present_mode);
 
+    // Core profile does not support glGetString(GL_EXTENSIONS), which older GLEW uses unless experimental.
+    glewExperimental = GL_TRUE;
     if(glewInit() != GLEW_OK){
         throw std::runtime_error { "Failed to initialize GLEW" };
     }
+    Capabilities::detect();
 
     glfwGetFramebufferSize(window, &framebuffer_size.x, &framebuffer_size.y);
+    golden_image_test = GoldenImageTest::fromEnvironment(title);
 
     // Make callback can access the class instance using pointer.
     glfwSetWindowUserPointer(window, this);
@@ -77,43 +193,273 @@ OpenGL::Window::Window(int width, int height, const char *title)
         auto *app = static_cast<Window*>(glfwGetWindowUserPointer(window_ptr));
         app->onFramebufferSizeChanged(width, height);
     });
+    // Input events are queued and dispatched once per frame in pollEvents().
     glfwSetKeyCallback(window, [](GLFWwindow* window_ptr, int key, int scancode, int action, int mods){
         auto *app = static_cast<Window*>(glfwGetWindowUserPointer(window_ptr));
-        app->onKeyChanged(key, scancode, action, mods);
+        app->enqueueInputEvent(KeyEvent { key, scancode, action, mods });
     });
     glfwSetMouseButtonCallback(window, [](GLFWwindow* window_ptr, int button, int action, int mods){
         auto *app = static_cast<Window*>(glfwGetWindowUserPointer(window_ptr));
-        app->onMouseButtonChanged(button, action, mods);
+        app->enqueueInputEvent(MouseButtonEvent { button, action, mods });
     });
     glfwSetCursorPosCallback(window, [](GLFWwindow* window_ptr, double xpos, double ypos){
         auto *app = static_cast<Window*>(glfwGetWindowUserPointer(window_ptr));
-        app->onCursorPosChanged(xpos, ypos);
+        app->enqueueInputEvent(CursorPosEvent { { xpos, ypos } });
     });
     glfwSetScrollCallback(window, [](GLFWwindow* window_ptr, double xoffset, double yoffset){
         auto *app = static_cast<Window*>(glfwGetWindowUserPointer(window_ptr));
-        app->onScrollChanged(xoffset, yoffset);
+        app->enqueueInputEvent(ScrollEvent { { xoffset, yoffset } });
     });
 }
 
 OpenGL::Window::~Window() noexcept {
+    // Its pixel buffer objects must be deleted while the context is alive.
+    golden_image_test.reset();
+    ObjectPool::flush();
+    if (previous_frame_fence){
+        glDeleteSync(previous_frame_fence);
+    }
     glfwDestroyWindow(window);
     glfwTerminate();
 }
 
-void OpenGL::Window::run() {
+void OpenGL::Window::enqueueInputEvent(const InputEvent &event) {
+    if (!input_events.push(event)){
+        // Queue is full: dispatch the queued events now and retry.
+        dispatchInputEvents();
+        input_events.push(event);
+    }
+}
+
+void OpenGL::Window::dispatchInputEvents() {
+    input_events.consumeAll([this](const InputEvent &event) {
+        input_state.apply(event);
+
+        if (const auto *key = std::get_if<KeyEvent>(&event)){
+            onKeyChanged(key->key, key->scancode, key->action, key->mods);
+        }
+        else if (const auto *mouse_button = std::get_if<MouseButtonEvent>(&event)){
+            onMouseButtonChanged(mouse_button->button, mouse_button->action, mouse_button->mods);
+        }
+        else if (const auto *cursor_pos = std::get_if<CursorPosEvent>(&event)){
+            onCursorPosChanged(cursor_pos->position.x, cursor_pos->position.y);
+        }
+        else if (const auto *scroll = std::get_if<ScrollEvent>(&event)){
+            onScrollChanged(scroll->offset.x, scroll->offset.y);
+        }
+    });
+}
+
+void OpenGL::Window::waitForNextFrame() {
+    if (frame_rate_limit.has_value()){
+        // Sleeping is only accurate to the OS scheduler granularity (~1 ms, often worse), so sleep until slightly
+        // before the deadline and spin for the rest.
+        constexpr double spin_duration = 2e-3;
+
+        next_frame_time += 1.0 / frame_rate_limit.value();
+        const double now = glfwGetTime();
+        if (now > next_frame_time){
+            // Deadline already missed: start the next period from now rather than rendering a burst of frames.
+            next_frame_time = now;
+        }
+        else{
+            if (next_frame_time - now > spin_duration){
+                std::this_thread::sleep_for(std::chrono::duration<double> { next_frame_time - now - spin_duration });
+            }
+            while (glfwGetTime() < next_frame_time);
+        }
+    }
+
+    if (previous_frame_fence){
+        // Wait until GPU finished the previous frame, so that CPU does not queue up frames ahead of the GPU.
+        constexpr GLuint64 timeout = 100'000'000; // 100 ms, in nanoseconds.
+        glClientWaitSync(previous_frame_fence, GL_SYNC_FLUSH_COMMANDS_BIT, timeout);
+        glDeleteSync(previous_frame_fence);
+        previous_frame_fence = nullptr;
+    }
+}
+
+double OpenGL::Window::pollEvents() {
+    glfwPollEvents();
+    dispatchInputEvents();
+    return glfwGetTime();
+}
+
+void OpenGL::Window::present(double input_time) {
+    // The back buffer is undefined after swapping the buffers.
+    if (golden_image_test && golden_image_test->endFrame(framebuffer_size)){
+        glfwSetWindowShouldClose(window, GLFW_TRUE);
+    }
+
+    glfwSwapBuffers(window);
+    const double present_time = glfwGetTime();
+
+    if (low_latency){
+        previous_frame_fence = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+    }
+    ObjectPool::endFrame();
+    if (GLIntercept::isEnabled()){
+        GLIntercept::endFrame();
+    }
+
+    frame_statistics.frame_time = static_cast<float>(present_time - previous_present_time);
+    previous_present_time = present_time;
+
+    constexpr float smoothing_factor = 0.1f;
+    frame_statistics.input_to_submit_latency = static_cast<float>(present_time - input_time);
+    frame_statistics.average_input_to_submit_latency = frame_statistics.average_input_to_submit_latency == 0.f
+        ? frame_statistics.input_to_submit_latency
+        : glm::mix(frame_statistics.average_input_to_submit_latency, frame_statistics.input_to_submit_latency, smoothing_factor);
+}
+
+float OpenGL::Window::advance(float time_delta) {
+    if (!fixed_timestep.has_value()){
+        update(time_delta);
+        input_state.consumeDeltas();
+        return 1.f;
+    }
+
+    const float tick_delta = 1.f / fixed_timestep->tick_rate;
+    const float max_accumulated_time = static_cast<float>(fixed_timestep->max_ticks_per_frame) * tick_delta;
+
+    // Clamp the accumulated time, so that a slow frame does not make the next frame even slower.
+    accumulated_time = std::fmin(accumulated_time + time_delta, max_accumulated_time);
+    while (accumulated_time >= tick_delta){
+        // Each delta is applied once: by the first tick of the frame, or by the first tick of a later frame if none.
+        update(tick_delta);
+        input_state.consumeDeltas();
+        accumulated_time -= tick_delta;
+    }
+    return accumulated_time / tick_delta;
+}
+
+void OpenGL::Window::runSerial() {
     float elapsed_time = 0.f;
     while (!glfwWindowShouldClose(window)) {
-        glfwPollEvents();
+        waitForNextFrame();
+        const double input_time = pollEvents();
 
-        const auto time_delta = static_cast<float>(glfwGetTime()) - elapsed_time;
+        auto time_delta = static_cast<float>(glfwGetTime()) - elapsed_time;
         elapsed_time += time_delta;
+        if (golden_image_test){
+            // Constant time delta for reproducible frames.
+            time_delta = GoldenImageTest::getTimeDelta();
+        }
 
-        update(time_delta);
-        draw();
-        glfwSwapBuffers(window);
+        const float interpolation_alpha = advance(time_delta);
+        publishRenderState();
+        draw(interpolation_alpha);
+        present(input_time);
+    }
+}
+
+void OpenGL::Window::runPipelined() {
+    // Prepare the render state of the first frame in the GL thread, so that there is something to draw.
+    double input_time = pollEvents();
+    float elapsed_time = static_cast<float>(glfwGetTime());
+    float interpolation_alpha = advance(golden_image_test ? GoldenImageTest::getTimeDelta() : elapsed_time);
+    publishRenderState();
+
+    UpdateWorker update_worker { [this](float time_delta) { return advance(time_delta); } };
+    while (!glfwWindowShouldClose(window)) {
+        waitForNextFrame();
+
+        // Event callbacks are called while the worker thread is idle.
+        const double next_input_time = pollEvents();
+
+        auto time_delta = static_cast<float>(glfwGetTime()) - elapsed_time;
+        elapsed_time += time_delta;
+        if (golden_image_test){
+            // Constant time delta for reproducible frames.
+            time_delta = GoldenImageTest::getTimeDelta();
+        }
+
+        // Update frame N+1 in the worker thread while drawing frame N.
+        update_worker.request(time_delta);
+        draw(interpolation_alpha);
+        present(input_time);
+        interpolation_alpha = update_worker.wait();
+
+        publishRenderState();
+        input_time = next_input_time;
     }
 }
 
+void OpenGL::Window::setPipelined(bool enabled) noexcept {
+    pipelined = enabled;
+}
+
+void OpenGL::Window::run() {
+    if (pipelined){
+        runPipelined();
+    }
+    else{
+        runSerial();
+    }
+
+    if (golden_image_test){
+        golden_image_test->check();
+    }
+}
+
+void OpenGL::Window::setFixedTimestep(std::optional<FixedTimestep> timestep) {
+    if (timestep && !(timestep->tick_rate > 0.f)){
+        throw std::runtime_error { "Tick rate must be positive." };
+    }
+
+    fixed_timestep = timestep;
+    accumulated_time = 0.f;
+}
+
+OpenGL::Window::PresentMode OpenGL::Window::setPresentMode(PresentMode mode) {
+    if (mode == PresentMode::AdaptiveVSync &&
+        !glfwExtensionSupported("WGL_EXT_swap_control_tear") && !glfwExtensionSupported("GLX_EXT_swap_control_tear")){
+        mode = PresentMode::VSync;
+    }
+
+    switch (mode){
+        case PresentMode::Immediate:
+            glfwSwapInterval(0);
+            break;
+        case PresentMode::VSync:
+            glfwSwapInterval(1);
+            break;
+        case PresentMode::AdaptiveVSync:
+            glfwSwapInterval(-1);
+            break;
+    }
+    return present_mode = mode;
+}
+
+void OpenGL::Window::setFrameRateLimit(std::optional<float> frames_per_second) {
+    if (frames_per_second && !(*frames_per_second > 0.f)){
+        throw std::runtime_error { "Frame rate limit must be positive." };
+    }
+
+    frame_rate_limit = frames_per_second;
+    next_frame_time = glfwGetTime();
+}
+
+void OpenGL::Window::setLowLatencyMode(bool enabled) noexcept {
+    low_latency = enabled;
+}
+
+OpenGL::Window::PresentMode OpenGL::Window::getPresentMode() const noexcept {
+    return present_mode;
+}
+
+const OpenGL::Window::FrameStatistics &OpenGL::Window::getFrameStatistics() const noexcept {
+    return frame_statistics;
+}
+
+bool OpenGL::Window::isPipelined() const noexcept {
+    return pipelined;
+}
+
+const OpenGL::InputState &OpenGL::Window::getInputState() const noexcept {
+    return input_state;
+}
+
 glm::uvec2 OpenGL::Window::getSize() const noexcept {
     return size;
 }
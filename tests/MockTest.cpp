@@ -0,0 +1,331 @@
+//
+// Created by gomkyung2 on 2026/10/19.
+//
+
+/* Tests of the CPU-side logic of the library against the recording mock GL backend (see Mock.hpp). Each test checks the
+ * GL call stream which the library issues, and runs in its own process, since the library state (programs in use,
+ * pooled handles) is global:
+ *
+ *     OpenGLApp_MockTest <test name>
+ */
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <exception>
+#include <initializer_list>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <variant>
+#include <vector>
+
+#include "OpenGLApp/Capabilities.hpp"
+#include "OpenGLApp/CommandList.hpp"
+#include "OpenGLApp/GLObject.hpp"
+#include "OpenGLApp/Mock.hpp"
+#include "OpenGLApp/MipChain.hpp"
+#include "OpenGLApp/Program.hpp"
+#include "OpenGLApp/RenderQueue.hpp"
+#include "OpenGLApp/Shader.hpp"
+#include "OpenGLApp/State.hpp"
+#include "OpenGLApp/TextureStreamer.hpp"
+
+namespace{
+    namespace Mock = OpenGL::Mock;
+
+    void expect(bool condition, std::string_view message){
+        if (!condition){
+            throw std::runtime_error { std::string { message } };
+        }
+    }
+
+    std::vector<const Mock::Call*> findCalls(std::string_view name){
+        std::vector<const Mock::Call*> calls;
+        for (const Mock::Call &call : Mock::getCalls()){
+            if (call.name == name){
+                calls.push_back(&call);
+            }
+        }
+        return calls;
+    }
+
+    std::int64_t getInteger(const Mock::Call &call, std::size_t index){
+        return std::get<std::int64_t>(call.arguments.at(index));
+    }
+
+    double getFloat(const Mock::Call &call, std::size_t index){
+        return std::get<double>(call.arguments.at(index));
+    }
+
+    const void *getPointer(const Mock::Call &call, std::size_t index){
+        return std::get<const void*>(call.arguments.at(index));
+    }
+
+    // Names of the recorded calls of the given entry points, in the order of issue.
+    std::vector<std::string_view> getCallNames(std::initializer_list<std::string_view> names){
+        std::vector<std::string_view> result;
+        for (const Mock::Call &call : Mock::getCalls()){
+            if (std::ranges::find(names, call.name) != names.end()){
+                result.push_back(call.name);
+            }
+        }
+        return result;
+    }
+
+    OpenGL::Program createProgram(){
+        const OpenGL::Shader vertex_shader = OpenGL::Shader::fromSource(GL_VERTEX_SHADER, R"(
+            #version 330 core
+            layout (location = 0) in vec3 inPosition;
+            uniform float scale;
+            void main(){
+                gl_Position = vec4(scale * inPosition, 1.0);
+            }
+        )");
+        const OpenGL::Shader fragment_shader = OpenGL::Shader::fromSource(GL_FRAGMENT_SHADER, R"(
+            #version 330 core
+            out vec4 fragColor;
+            void main(){
+                fragColor = vec4(1.0);
+            }
+        )");
+        return OpenGL::Program { vertex_shader, fragment_shader };
+    }
+
+    // Uniforms of an unused program are queued by OpenGL::State until it is used, since the mock context is GL 3.3
+    // without glProgramUniform*.
+    void testUniformFlush(){
+        const OpenGL::Program used = createProgram(), unused = createProgram();
+        used.use();
+        Mock::clearCalls();
+
+        unused.setUniform("scale", 2.f);
+        expect(Mock::countCalls("glUniform1f") == 0 && Mock::countCalls("glUseProgram") == 0, "Uniform of an unused program is set before it is used.");
+
+        used.setUniform("scale", 3.f);
+        expect(Mock::countCalls("glUniform1f") == 1 && Mock::countCalls("glUseProgram") == 0, "Uniform of the used program is not set immediately.");
+
+        Mock::clearCalls();
+        unused.use();
+        expect(getCallNames({ "glUseProgram", "glUniform1f" }) == std::vector<std::string_view> { "glUseProgram", "glUniform1f" }, "Queued uniform is not set right after the program is used.");
+        expect(getInteger(*findCalls("glUseProgram").front(), 0) == unused.getHandle(), "Wrong program is used.");
+        expect(getFloat(*findCalls("glUniform1f").front(), 1) == 2.0, "Queued uniform has a wrong value.");
+
+        unused.use();
+        expect(Mock::countCalls("glUseProgram") == 1, "Program in use is used again.");
+
+        // Flushing uses the program only for its pending uniforms, then restores the used one.
+        Mock::clearCalls();
+        used.setUniform("scale", 4.f);
+        OpenGL::State::flushPendingUniforms(used.getHandle());
+        const std::vector use_calls = findCalls("glUseProgram");
+        expect(use_calls.size() == 2 && getInteger(*use_calls[0], 0) == used.getHandle() && getInteger(*use_calls[1], 0) == unused.getHandle(),
+               "Flushing does not restore the used program.");
+
+        GLfloat value;
+        glGetUniformfv(used.getHandle(), used.getUniformLocation("scale"), &value);
+        expect(value == 4.f, "Flushed uniform has a wrong value.");
+    }
+
+    // Items pushed alternating between two programs and vertex arrays are drawn grouped by them, and translucent items
+    // are drawn back to front after the opaque ones.
+    void testRenderQueueSort(){
+        const OpenGL::Program first_program = createProgram(), second_program = createProgram();
+        const OpenGL::VertexArray first_vertex_array, second_vertex_array;
+
+        OpenGL::RenderQueue queue;
+        queue.setDepthRange(0.f, 100.f);
+        queue.setDepthOrder(1, OpenGL::RenderQueue::DepthOrder::BackToFront);
+
+        // first is the index of the item, to identify it in the draw calls.
+        const auto push = [&](std::uint8_t pass, const OpenGL::Program &program, const OpenGL::VertexArray &vertex_array, float depth, std::uintptr_t first){
+            queue.push({
+                .pass = pass, .program = program.getHandle(), .vertex_array = vertex_array.getHandle(), .depth = depth,
+                .count = 3, .first = first,
+            });
+        };
+        push(1, first_program, first_vertex_array, 10.f, 0);
+        push(0, first_program, first_vertex_array, 20.f, 1);
+        push(0, second_program, second_vertex_array, 10.f, 2);
+        push(0, first_program, first_vertex_array, 10.f, 3);
+        push(0, second_program, second_vertex_array, 30.f, 4);
+        push(1, first_program, first_vertex_array, 50.f, 5);
+
+        Mock::clearCalls();
+        queue.submit();
+
+        std::vector<std::int64_t> order;
+        for (const Mock::Call *call : findCalls("glDrawArraysInstanced")){
+            order.push_back(getInteger(*call, 1));
+        }
+        // Pass 0 grouped by program then sorted front to back, pass 1 back to front.
+        expect(order == std::vector<std::int64_t> { 3, 1, 2, 4, 5, 0 }, "Items are drawn in a wrong order.");
+
+        const OpenGL::RenderQueue::Statistics &statistics = queue.getStatistics();
+        expect(statistics.draw_count == 6, "Wrong draw count.");
+        expect(statistics.sorted.program == 3 && statistics.sorted.vertex_array == 3, "Wrong switch counts of the sorted order.");
+        expect(statistics.unsorted.program == 5 && statistics.unsorted.vertex_array == 5, "Wrong switch counts of the push order.");
+        expect(Mock::countCalls("glUseProgram") == statistics.sorted.program, "Redundant program switches are issued.");
+        expect(Mock::countCalls("glBindVertexArray") == statistics.sorted.vertex_array, "Redundant vertex array binds are issued.");
+    }
+
+    // Recording issues no GL call, and execute() replays the commands in order, as many times as called.
+    void testCommandListReplay(){
+        const OpenGL::Program program = createProgram();
+        const OpenGL::VertexArray vertex_array;
+        const OpenGL::Texture texture;
+        const GLint scale_location = program.getUniformLocation("scale");
+        Mock::clearCalls();
+
+        OpenGL::CommandList command_list;
+        command_list.useProgram(program);
+        command_list.setUniform(program.getHandle(), scale_location, 2.f);
+        command_list.setUniform(program.getHandle(), -1, 3.f); // Dropped.
+        command_list.bindVertexArray(vertex_array.getHandle());
+        command_list.bindTexture(1, GL_TEXTURE_2D, texture.getHandle());
+        command_list.drawElements(GL_TRIANGLES, 6, GL_UNSIGNED_INT, 12);
+        command_list.drawArrays(GL_POINTS, 0, 4, 2);
+        expect(Mock::getCalls().empty(), "Recording issues GL calls.");
+        expect(command_list.size() == 6, "Wrong command count.");
+
+        const std::initializer_list<std::string_view> names {
+            "glUseProgram", "glUniform1f", "glBindVertexArray", "glActiveTexture", "glBindTexture", "glDrawElements", "glDrawArraysInstanced"
+        };
+        command_list.execute();
+        expect(getCallNames(names) == std::vector<std::string_view> { names }, "Commands are replayed in a wrong order.");
+
+        const Mock::Call &draw_elements = *findCalls("glDrawElements").front();
+        expect(getInteger(draw_elements, 1) == 6 && getPointer(draw_elements, 3) == reinterpret_cast<const void*>(12), "Indexed draw has wrong arguments.");
+        expect(getInteger(*findCalls("glActiveTexture").front(), 0) == GL_TEXTURE1, "Texture is bound to a wrong unit.");
+
+        // Program is still in use, so only the uniform and the binds are issued again.
+        Mock::clearCalls();
+        command_list.execute();
+        expect(Mock::countCalls("glUseProgram") == 0 && Mock::countCalls("glUniform1f") == 1 && Mock::countCalls("glDrawElements") == 1,
+               "Second replay issues wrong calls.");
+
+        command_list.clear();
+        Mock::clearCalls();
+        command_list.execute();
+        expect(command_list.empty() && Mock::getCalls().empty(), "Cleared list issues GL calls.");
+    }
+
+    // GL_TEXTURE_BASE_LEVEL of a streamed texture whose level is uploaded (evicted) is set right after (before) its level
+    // is specified (freed).
+    void testTextureStreamerResidency(){
+        constexpr int size = 256; // Levels 0 (256) and 1 (128) are streamed above the initial size.
+        const std::vector<unsigned char> pixels(size * size * 4, 128);
+
+        OpenGL::TextureStreamer streamer { static_cast<std::size_t>(-1), 64 };
+        const std::size_t first = streamer.add(OpenGL::MipChain { size, size, 4, pixels.data() });
+        const std::size_t second = streamer.add(OpenGL::MipChain { size, size, 4, pixels.data() });
+        streamer.update();
+        const std::size_t initial_bytes = streamer.getStatistics().resident_bytes;
+        constexpr std::size_t streamed_bytes = (size * size + size * size / 4) * 4;
+
+        // Room for only one texture to be fully resident.
+        streamer.setBudget(initial_bytes + streamed_bytes);
+
+        const auto get_levels = [](std::string_view name, GLuint texture){
+            // (level, pixels) of glTexImage2D, or (-1, base level) of glTexParameteri, of the texture.
+            std::vector<std::pair<std::int64_t, bool>> levels;
+            GLuint bound = 0;
+            for (const Mock::Call &call : Mock::getCalls()){
+                if (call.name == "glBindTexture"){
+                    bound = static_cast<GLuint>(getInteger(call, 1));
+                }
+                else if (bound == texture && call.name == "glTexImage2D" && name == call.name){
+                    levels.emplace_back(getInteger(call, 1), getPointer(call, 8) != nullptr);
+                }
+                else if (bound == texture && call.name == "glTexParameteri" && name == call.name && getInteger(call, 1) == GL_TEXTURE_BASE_LEVEL){
+                    levels.emplace_back(getInteger(call, 2), true);
+                }
+            }
+            return levels;
+        };
+        using Levels = std::vector<std::pair<std::int64_t, bool>>;
+
+        Mock::clearCalls();
+        streamer.request(first, size);
+        streamer.update();
+        expect(get_levels("glTexImage2D", streamer.getHandle(first)) == Levels { { 1, true }, { 0, true } }, "Requested levels are not uploaded from the coarsest.");
+        expect(get_levels("glTexParameteri", streamer.getHandle(first)) == Levels { { 1, true }, { 0, true } }, "Base level does not follow the uploads.");
+        expect(streamer.getStatistics().uploaded_levels == 2 && streamer.getStatistics().evicted_levels == 0, "Wrong upload statistics.");
+
+        // The first texture, not requested in this frame, makes room for the second.
+        Mock::clearCalls();
+        streamer.request(second, size);
+        streamer.update();
+        expect(get_levels("glTexImage2D", streamer.getHandle(first)) == Levels { { 0, false }, { 1, false } }, "Levels are not evicted from the finest.");
+        expect(get_levels("glTexParameteri", streamer.getHandle(first)) == Levels { { 1, true }, { 2, true } }, "Base level does not follow the evictions.");
+        expect(get_levels("glTexImage2D", streamer.getHandle(second)) == Levels { { 1, true }, { 0, true } }, "Requested levels are not uploaded.");
+        expect(streamer.getStatistics().uploaded_levels == 2 && streamer.getStatistics().evicted_levels == 2 && streamer.getStatistics().starved_textures == 0,
+               "Wrong eviction statistics.");
+        expect(streamer.getStatistics().resident_bytes <= initial_bytes + streamed_bytes, "Budget is exceeded.");
+
+        // Base level is raised before the storage of the level is released.
+        const std::vector names = getCallNames({ "glTexParameteri", "glTexImage2D" });
+        expect(names.size() >= 2 && names[0] == "glTexParameteri" && names[1] == "glTexImage2D", "Level is freed while it is the base level.");
+    }
+
+    // Released handles are deleted only after the fence of their frame, together by one glDelete* call per type.
+    void testObjectPoolFencedDeletion(){
+        {
+            const OpenGL::Buffer first, second;
+            const OpenGL::VertexArray vertex_array;
+        }
+        expect(OpenGL::ObjectPool::getStatistics().pending_deletions == 3, "Released handles are not pending.");
+        expect(Mock::countCalls("glDeleteBuffers") == 0 && Mock::countCalls("glDeleteVertexArrays") == 0, "Handles are deleted before the end of the frame.");
+
+        Mock::clearCalls();
+        OpenGL::ObjectPool::endFrame();
+        expect(getCallNames({ "glFenceSync", "glClientWaitSync", "glDeleteSync", "glDeleteBuffers" }) ==
+               std::vector<std::string_view> { "glFenceSync", "glClientWaitSync", "glDeleteSync", "glDeleteBuffers" },
+               "Handles are not deleted after the fence is signaled.");
+        expect(getInteger(*findCalls("glDeleteBuffers").front(), 0) == 2 && getInteger(*findCalls("glDeleteVertexArrays").front(), 0) == 1,
+               "Handles of a type are not deleted together.");
+        expect(OpenGL::ObjectPool::getStatistics().pending_deletions == 0 && OpenGL::ObjectPool::getStatistics().deleted_handles == 3, "Wrong deletion statistics.");
+
+        // Nothing released, nothing fenced.
+        Mock::clearCalls();
+        OpenGL::ObjectPool::endFrame();
+        expect(Mock::countCalls("glFenceSync") == 0, "Fence is put after a frame without released handles.");
+
+        // Pooled handles are reused before any generation.
+        const OpenGL::ObjectPool::Statistics before = OpenGL::ObjectPool::getStatistics();
+        const OpenGL::Buffer buffer;
+        expect(Mock::countCalls("glGenBuffers") == 0 && OpenGL::ObjectPool::getStatistics().free_handles + 1 == before.free_handles, "Pooled handle is not reused.");
+    }
+
+    constexpr std::pair<std::string_view, void(*)()> tests[] {
+        { "UniformFlush", &testUniformFlush },
+        { "RenderQueueSort", &testRenderQueueSort },
+        { "CommandListReplay", &testCommandListReplay },
+        { "TextureStreamerResidency", &testTextureStreamerResidency },
+        { "ObjectPoolFencedDeletion", &testObjectPoolFencedDeletion },
+    };
+}
+
+int main(int argc, char **argv){
+    const auto it = argc == 2 ? std::ranges::find(tests, std::string_view { argv[1] }, &std::pair<std::string_view, void(*)()>::first) : std::end(tests);
+    if (it == std::end(tests)){
+        std::fputs("Usage: OpenGLApp_MockTest <test name>\nTests:\n", stderr);
+        for (const auto &[name, test] : tests){
+            std::fprintf(stderr, "  %.*s\n", static_cast<int>(name.size()), name.data());
+        }
+        return 2;
+    }
+
+    try{
+        // Window does it after creating the context.
+        OpenGL::Capabilities::detect();
+        it->second();
+    }
+    catch (const std::exception &e){
+        std::fprintf(stderr, "%s\n", e.what());
+        return 1;
+    }
+    return 0;
+}